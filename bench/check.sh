@@ -0,0 +1,53 @@
+#!/bin/sh
+# Run every program in bench/ and bench/edge/ in each of the ways codegen
+# can run it and compare the output with <program>.out, so that a pass or
+# mode that changes what a program does shows up. The programs in
+# bench/edge/ start out next to the edge of the tape, where code that
+# touches cells the program doesn't goes off it.
+#
+# With llc and cc on the PATH, it also links each program compiled with
+# --entry against entry.c, which runs bf_run() at position 0 of a tape of
+# exactly --tape-size cells between pages that can't be accessed.
+#
+# usage: bench/check.sh [path to codegen]
+#
+# Prints every run that fails and exits with status 1 if any did.
+CODEGEN=${1:-./codegen}
+BENCH_DIR=$(dirname "$0")
+STATUS=0
+
+for program in "$BENCH_DIR"/*.b "$BENCH_DIR"/edge/*.b; do
+    [ -f "$program.out" ] || continue
+    input=/dev/null
+    [ -f "$program.in" ] && input=$program.in
+
+    for flags in "" "--ast-passes=false" "--stream" "--bounds-check" "--backend=x86" "--backend=stencil"; do
+        # $flags is split into words on purpose
+        if ! "$CODEGEN" --run $flags "$program" < "$input" 2>&1 | cmp -s - "$program.out"; then
+            echo "$program ${flags:-(default)}: output differs from $program.out"
+            STATUS=1
+        fi
+    done
+done
+
+if command -v llc > /dev/null && command -v cc > /dev/null; then
+    ENTRY_DIR=$(mktemp -d)
+    trap 'rm -rf "$ENTRY_DIR"' EXIT
+    TAPE_SIZE=65536
+    for program in "$BENCH_DIR"/*.b "$BENCH_DIR"/edge/*.b; do
+        [ -f "$program.out" ] || continue
+        input=/dev/null
+        [ -f "$program.in" ] && input=$program.in
+
+        for flags in "" "--ast-passes=false" "--bounds-check"; do
+            if ! "$CODEGEN" --entry --tape-size=$TAPE_SIZE $flags "$program" \
+                    | llc -O2 -filetype=obj -relocation-model=pic -o "$ENTRY_DIR/program.o" \
+                || ! cc "$BENCH_DIR/entry.c" "$ENTRY_DIR/program.o" -o "$ENTRY_DIR/program" \
+                || ! "$ENTRY_DIR/program" $TAPE_SIZE < "$input" 2>&1 | cmp -s - "$program.out"; then
+                echo "$program --entry ${flags:-(default)}: output differs from $program.out"
+                STATUS=1
+            fi
+        done
+    done
+fi
+exit $STATUS
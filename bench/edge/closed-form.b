@@ -0,0 +1,2 @@
+A loop nest with a closed form that would reach two cells to the left of the first one
+,[<+++[-<+>]>-]+.
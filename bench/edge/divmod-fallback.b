@@ -0,0 +1,2 @@
+The divmod idiom on a layout it does not expect followed by a skipped multiply loop
+-[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<][-<->].
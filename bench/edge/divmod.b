@@ -0,0 +1,2 @@
+The divmod idiom mirrored and not entered on the first cell after one that is
+.>++-+.[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<].[-<+<-[<+<<]<[+[->+<]<+<<]>>>>>>]++.
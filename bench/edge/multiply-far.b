@@ -0,0 +1,2 @@
+A multiply loop two cells to the left of where it starts that is never entered
+>[-<<+>>]+.
@@ -0,0 +1,2 @@
+A multiply loop to the left of the first cell that is never entered and a zero output
+[-<->].
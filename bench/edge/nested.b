@@ -0,0 +1,2 @@
+A nest whose inner loop never runs but would reach the cell left of it
++[>[<<+>>-]<-]+.
@@ -0,0 +1,2 @@
+A chain of transfer loops that would carry to the cell left of the first one
+[-<+>]>[-<+>]<+.
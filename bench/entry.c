@@ -0,0 +1,52 @@
+// Runs a program compiled with `codegen --entry` at position 0 of a tape
+// of exactly --tape-size cells, with inaccessible pages on either side of
+// it, so that bf_run() touching any cell the program doesn't get to
+// crashes. Used by check.sh.
+//
+// usage: entry <tape size> < input, the tape size a multiple of the page size
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "../bfllvm.h"
+
+static int put(void *context, int c) {
+    return putc(c, (FILE *)context);
+}
+
+static int get(void *context) {
+    (void)context;
+    return getchar();
+}
+
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s <tape size>\n", argv[0]);
+        return 2;
+    }
+    size_t size = strtoull(argv[1], NULL, 0);
+    size_t page = sysconf(_SC_PAGESIZE);
+    if (size == 0 || size % page != 0) {
+        fprintf(stderr, "%s: the tape size must be a multiple of %zu\n", argv[0], page);
+        return 2;
+    }
+
+    uint8_t *pages = mmap(NULL, size + 2 * page, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (pages == MAP_FAILED) {
+        perror("mmap");
+        return 2;
+    }
+    uint8_t *tape = pages + page;
+    if (mprotect(tape, size, PROT_READ | PROT_WRITE) != 0) {
+        perror("mprotect");
+        return 2;
+    }
+
+    struct bf_io io = { stdout, put, get };
+    if (bf_run(tape, 0, &io) == BF_OVERRUN) {
+        fprintf(stderr, "tape overrun\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,1065 @@
+Factors the numbers on the lines of its input into primes by trial division
+The numbers are kept one decimal digit per cell and divided by long division
+with repeated subtraction; each line of output lists a number and its factors
+
+>[-]+[<,[->>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<
+<<<+>>>>>>>>>>>>>>>]<<+<<<<<<<<<<<+>>>>>>>>>>>[[-]<<<<<<<<<<<->>>>>>>>>>
+>]<<<<<<<<<<+<[<[-]<[-]>>>[-]<[-]]>[<<<[->>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<
+<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<<----------<<<<<<<<<
+<<+>>>>>>>>>>>[[-]<<<<<<<<<<<->>>>>>>>>>>]<<<<<[-]+<<<<<<[[-]>>>>>>[-]<<
+<<<<]>>>>>>[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<[->>>
+>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>
+>+<<<<<<<<<<<<<<<<<<]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<
+<<<<<<]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]<<<<<<<
+<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]<<<<<<<<<<<<<<<<<<[->
+>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>
+>>>+<<<<<<<<<<<<<<<<<<]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<
+<<<<<<<<]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]<<<<<
+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]<<<<<<<<<<<<<<<<<<[
+->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>
+>>>>>+<<<<<<<<<<<<<<<<<<]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<
+<<<<<<<<<<]<<<<<<<<<<<<<<<<<<<<<<<<-------------------------------------
+-----------[->>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<],[->>>>>>
+>>>>>>>+>>+<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>
+>>>]<<----------<<<<<<<<<<<+>>>>>>>>>>>[[-]<<<<<<<<<<<->>>>>>>>>>>]<<<<<
+<<<<<<[[-]>>>>>>[-]<<<<<<]>>>>>>]<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[[-
+]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<]>>>[-<<<+>>>]>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[[-]<++++++++++++++++++++++++++++++++++
+++++++++++++++<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>
+>>]<<.[-]>]<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<
+<<<<<<<<+>>>>>>>>>]<[[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<]>>>[-<<<+>
+>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>[[-]<+++++++++++++++++++++++++++++++++++++++++++++++
++<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<.[-]>]<<
+<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>
+>>>>>]<[[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<]>>>[-<<<+>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[[-]<++++++++++++++++++++++++
+++++++++++++++++++++++++<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<
+<<+>>>>>>>>>]<<.[-]>]<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>
+>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<]>>>[-<<<+>>>]>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[[-]<+++++++++++++++++++++++++++++++++++++
++++++++++++<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]
+<<.[-]>]<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<
+<<<<<+>>>>>>>>>]<[[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
++<<<]>>>[-<<<+>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[[-]<++++++++++++++
+++++++++++++++++++++++++++++++++++<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>
+>[-<<<<<<<<<+>>>>>>>>>]<<.[-]>]<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>+>+<<
+<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<+<<<]>>>[-<<<+>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[[-]<+++++++++++++++++++++++++++
++++++++++++++++++++++<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+
+>>>>>>>>>]<<.[-]>]<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>
+>>>>[-<<<<<<<<<+>>>>>>>>>]<[[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<]>>>[-<<<+>>>]>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[[-]<++++
+++++++++++++++++++++++++++++++++++++++++++++<<<<<<<[->>>>>>>+>>+<<<<<<<<
+<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<.[-]>]<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>
+>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[[-]<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<]>>>[-<<<+>>>]>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[[-]<+++++++++++++++++
++++++++++++++++++++++++++++++++<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-
+<<<<<<<<<+>>>>>>>>>]<<.[-]>]<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>+>+<<<<<
+<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<+<<<]>>>[-<<<+>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>[[-]<++++++++++++++++++++++++++++++++++++++++++++++++<<<<<<<[->>>>>>>+>
+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<.[-]>]<<<<<<<<<<<<<<<<<<<<<
+<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[[-]<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<+<<<]>>>[-<<<+>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[[-]<+++++++
++++++++++++++++++++++++++++++++++++++++++<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>
+>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<.[-]>]<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>
+>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[[-]<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<]>
+>>[-<<<+>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>[[-]<++++++++++++++++++++++++++++++++++++++++++++++++<<<<<<<[
+->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<.[-]>]<<<<<<<<<<<
+<<<<<<<<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[[
+-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+
+<<<]>>>[-<<<+>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[[
+-]<++++++++++++++++++++++++++++++++++++++++++++++++<<<<<<<[->>>>>>>+>>+<
+<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<.[-]>]<<<<<<<<<<<<<<<<<<<<<<<<
+<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[[-]<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<]>>>[-<<<+>>>]>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>[[-]<++++++++++++++++++++++++++++++++++++++++++++++
+++<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<.[-]>]<
+<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++<<<<<<
+<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<.[-]<<<<<<<<<<<
+<<<<<<<<[-]<<<<<<<<<<<<+++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++.[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]++>>>>>>>>>>>>>>>>>>[-]>>>>
+>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>
+>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<[-]++++>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]
+>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>
+>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>
+[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+<<<[-]+[>>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>
+>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-
+]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>
+>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>
+>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>
++>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>>>[->>>+>>>>>>+<
+<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>>>[->>>+>>>>>>+<<<<<<<<<]
+>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>>>[->>>+>>>>>>+<<<<<<<<<]>>>>>>>>>
+[-<<<<<<<<<+>>>>>>>>>]>>>>>>>>>[->>>+>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<
+<<+>>>>>>>>>]>>>>>>>>>[->>>+>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>
+>>>]>>>>>>>>>[->>>+>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>
+>>>>[->>>+>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>>>[->>>
++>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>>>[->>>+>>>>>>+<
+<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>>>[->>>+>>>>>>+<<<<<<<<<]
+>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>>>[->>>+>>>>>>+<<<<<<<<<]>>>>>>>>>
+[-<<<<<<<<<+>>>>>>>>>]>>>>>>>>>[->>>+>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<
+<<+>>>>>>>>>]>>>>>>>>>[->>>+>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>
+>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++<[->->>>>>>+<<<<<<<]>>>>>>>[-<<<<<<
+<+>>>>>>>]>>>>>>>>>>>>+++++++++<[->->>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>
+>>>]>>>>>>>>>>>>+++++++++<[->->>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>
+>>>>>>>>>>+++++++++<[->->>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>>>>>>>
+>>>>+++++++++<[->->>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>>>>>>>>>>>++
++++++++<[->->>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>>>>>>>>>>>++++++++
++<[->->>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>>>>>>>>>>>+++++++++<[->-
+>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>>>>>>>>>>>+++++++++<[->->>>>>>
++<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>>>>>>>>>>>+++++++++<[->->>>>>>+<<<<<
+<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>>>>>>>>>>>+++++++++<[->->>>>>>+<<<<<<<]>>>
+>>>>[-<<<<<<<+>>>>>>>]>>>>>>>>>>>>+++++++++<[->->>>>>>+<<<<<<<]>>>>>>>[-
+<<<<<<<+>>>>>>>]>>>>>>>>>>>>+++++++++<[->->>>>>>+<<<<<<<]>>>>>>>[-<<<<<<
+<+>>>>>>>]>>>>>>>>>>>>+++++++++<[->->>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>
+>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<+[->>>>+<<<<]>>>>[->>>+<<<]>>>>>++++++++++<<
+[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<+>>>>>>>>>>]>[->>>
+>>>>+<<<<<<<]>>>>>>>[->>>>+<<<<]>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+
+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<+>>>>>>>>>>]>[->>>>>>>+<<<<
+<<<]>>>>>>>[->>>>+<<<<]>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<
++>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<+>>>>>>>>>>]>[->>>>>>>+<<<<<<<]>>>>>
+>>[->>>>+<<<<]>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<
+<<<<<]>[-]>[-]>[-<<<<<<<<<<+>>>>>>>>>>]>[->>>>>>>+<<<<<<<]>>>>>>>[->>>>+
+<<<<]>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-
+]>[-]>[-<<<<<<<<<<+>>>>>>>>>>]>[->>>>>>>+<<<<<<<]>>>>>>>[->>>>+<<<<]>>>>
+[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<
+<<<<<<<<<+>>>>>>>>>>]>[->>>>>>>+<<<<<<<]>>>>>>>[->>>>+<<<<]>>>>[->>>+<<<
+]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<
++>>>>>>>>>>]>[->>>>>>>+<<<<<<<]>>>>>>>[->>>>+<<<<]>>>>[->>>+<<<]>>>>>+++
++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<+>>>>>>>>
+>>]>[->>>>>>>+<<<<<<<]>>>>>>>[->>>>+<<<<]>>>>[->>>+<<<]>>>>>++++++++++<<
+[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<+>>>>>>>>>>]>[->>>
+>>>>+<<<<<<<]>>>>>>>[->>>>+<<<<]>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+
+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<+>>>>>>>>>>]>[->>>>>>>+<<<<
+<<<]>>>>>>>[->>>>+<<<<]>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<
++>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<+>>>>>>>>>>]>[->>>>>>>+<<<<<<<]>>>>>
+>>[->>>>+<<<<]>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<
+<<<<<]>[-]>[-]>[-<<<<<<<<<<+>>>>>>>>>>]>[->>>>>>>+<<<<<<<]>>>>>>>[->>>>+
+<<<<]>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-
+]>[-]>[-<<<<<<<<<<+>>>>>>>>>>]>[->>>>>>>+<<<<<<<]>>>>>>>[->>>>+<<<<]>>>>
+[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<
+<<<<<<<<<+>>>>>>>>>>]>[->>>+<<<]>>>[-]<<<<<<<<<<<<<<[->>>>+>>+<<<<<<]>>>
+>>>[-<<<<<<+>>>>>>]<<[->>>+<<<]>>>>>+++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<
+<<<]>[-]>[-]>[->>>>+<<<<]>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>[-]
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>
+>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>
+>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>
+>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>
+>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<[>>>>>>[
+-]<<<<[-]<<[-]]>>[>>>>>>[-]++++++++++++++[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>[->>>>>>>+<<<<<<<]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<
+<<<<<]>[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]<<<<<<<<<<<<<<<<<<<[->>>>
+>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<
+<<]<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>[->>>>>>>
+>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<
+<<<<<<<<<<<<<<<<<]>[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]<<<<<<<<<<<<<
+<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>[->>>>>>>>>>>>>>>>>>+<<<<
+<<<<<<<<<<<<<<]<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<
+<]>[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]<<<<<<<<<<<<<<<<<<<[->>>>>>>>
+>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]<
+<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>[->>>>>>>>>>>
+>>>>>>>+<<<<<<<<<<<<<<<<<<]<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<
+<<<<<<<<<<<<<]>[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]<<<<<<<<<<<<<<<<<
+<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>[->>>>>>>>>>>>>>>>>>+<<<<<<<<
+<<<<<<<<<<]<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>[
+->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>
+>>>>>>+<<<<<<<<<<<<<<<<<<]>[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]<<<<<
+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>[->>>>>>>>>>>>>>>
+>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]<<<<<<<<<<<<<<<<<<[->>>>
+>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>
++<<<<<<<<<<<<<<<<<<]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<
+<<<<<]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]<<<<<<<<
+<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]<<<<<<<<<<<<<<<<<<[->>
+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>
+>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>
+>>>+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+[>
+>>>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>
+>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>
+>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>+>>>+<<<<<]>>>>>[-<
+<<<<+>>>>>]>>>>>>>>>>>>>[->>+>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>>>>>>>>>>[
+->>+>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>>>>>>>>>>[->>+>>>+<<<<<]>>>>>[-<<<<
+<+>>>>>]>>>>>>>>>>>>>[->>+>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>>>>>>>>>>[->>
++>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>>>>>>>>>>[->>+>>>+<<<<<]>>>>>[-<<<<<+>
+>>>>]>>>>>>>>>>>>>[->>+>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>>>>>>>>>>[->>+>>
+>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++<[->->>>+<<<<]>>>>[-<<<<+>>>>]>>>
+>>>>>>>>>>>>+++++++++<[->->>>+<<<<]>>>>[-<<<<+>>>>]>>>>>>>>>>>>>>>++++++
++++<[->->>>+<<<<]>>>>[-<<<<+>>>>]>>>>>>>>>>>>>>>+++++++++<[->->>>+<<<<]>
+>>>[-<<<<+>>>>]>>>>>>>>>>>>>>>+++++++++<[->->>>+<<<<]>>>>[-<<<<+>>>>]>>>
+>>>>>>>>>>>>+++++++++<[->->>>+<<<<]>>>>[-<<<<+>>>>]>>>>>>>>>>>>>>>++++++
++++<[->->>>+<<<<]>>>>[-<<<<+>>>>]>>>>>>>>>>>>>>>+++++++++<[->->>>+<<<<]>
+>>>[-<<<<+>>>>]>>>>>>>>>>>>>>>+++++++++<[->->>>+<<<<]>>>>[-<<<<+>>>>]<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
++[->+<]>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]
+>[-]>[-<<<<<<<+>>>>>>>]>[->>>>>>>>>>+<<<<<<<<<<]>>>>>>>>>>[->+<]>[->>>+<
+<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<+
+>>>>>>>]>[->>>>>>>>>>+<<<<<<<<<<]>>>>>>>>>>[->+<]>[->>>+<<<]>>>>>+++++++
++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<+>>>>>>>]>[->>>>
+>>>>>>+<<<<<<<<<<]>>>>>>>>>>[->+<]>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>
+>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<+>>>>>>>]>[->>>>>>>>>>+<<<<<<<<
+<<]>>>>>>>>>>[->+<]>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>
+]<<<<<<]>[-]>[-]>[-<<<<<<<+>>>>>>>]>[->>>>>>>>>>+<<<<<<<<<<]>>>>>>>>>>[-
+>+<]>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-
+]>[-<<<<<<<+>>>>>>>]>[->>>>>>>>>>+<<<<<<<<<<]>>>>>>>>>>[->+<]>[->>>+<<<]
+>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<+>>>
+>>>>]>[->>>>>>>>>>+<<<<<<<<<<]>>>>>>>>>>[->+<]>[->>>+<<<]>>>>>++++++++++
+<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<+>>>>>>>]>[->>>>>>>
+>>>+<<<<<<<<<<]>>>>>>>>>>[->+<]>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>
+[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<+>>>>>>>]>[->>>+<<<]>>>[-]<<<<<<<<
+<<<[->+>>+<<<]>>>[-<<<+>>>]<<[->>>+<<<]>>>>>+++++<<[->+>-[>+>>]>[+[-<+>]
+>+>>]<<<<<<]>[-]>[-]>[->>>>+<<<<]>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
++>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<+<<<<<[>>>>>>>[-]<<[-]<<<<<[-]]>>>>>[>>>>>>>>>>>>>>>>>>>>>[-]>>>>>
+>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>
+>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>
+>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<[-<<+>>>>>+<<<]>>>[-<<<+>>>]>>>>>>>>>>>>>>>[-<<+>>>>>+<
+<<]>>>[-<<<+>>>]>>>>>>>>>>>>>>>[-<<+>>>>>+<<<]>>>[-<<<+>>>]>>>>>>>>>>>>>
+>>[-<<+>>>>>+<<<]>>>[-<<<+>>>]>>>>>>>>>>>>>>>[-<<+>>>>>+<<<]>>>[-<<<+>>>
+]>>>>>>>>>>>>>>>[-<<+>>>>>+<<<]>>>[-<<<+>>>]>>>>>>>>>>>>>>>[-<<+>>>>>+<<
+<]>>>[-<<<+>>>]>>>>>>>>>>>>>>>[-<<+>>>>>+<<<]>>>[-<<<+>>>]>>>>>>>>>>>>>>
+>[-<<+>>>>>+<<<]>>>[-<<<+>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<<<<<<<<<<<<<<<<[-]]>>>>>>>>>>>>
+>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>
+>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>
+>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>-]>>>>>>>>>
+>>>>>>>>>[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<[[-]<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>[->>>+>>+<<<<<]>>
+>>>[-<<<<<+>>>>>]<<[[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>[->>>+>
+>+<<<<<]>>>>>[-<<<<<+>>>>>]<<[[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>
+]<<[[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>[->>>+>>+<<<<<]>>>>>[-<
+<<<<+>>>>>]<<[[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>]>>>>>>>>>>>>>>>[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<[[-]<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<[[-
+]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>
+>>>>>>>[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<[[-]<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>]>>>>>>>>>>>>>>>[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<[[-]<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>
+[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>
+>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>
+>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<[>>>>+>>>>>[>>>>>>>>>>>>>>>>>>[-]+++>>>
+>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>
+>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]
+>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<[-]+++++++++>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>
+>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>
+>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>
+>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]
+>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>[-]]<
+<<<<[>>>>>>>>>>>>>>>>>>>>>>>[-<<<++++>>>>>>>+<<<<]>>>>[-<<<<+>>>>]>>>>>>
+>>>>>>>>[-<<<++++>>>>>>>+<<<<]>>>>[-<<<<+>>>>]>>>>>>>>>>>>>>[-<<<++++>>>
+>>>>+<<<<]>>>>[-<<<<+>>>>]>>>>>>>>>>>>>>[-<<<++++>>>>>>>+<<<<]>>>>[-<<<<
++>>>>]>>>>>>>>>>>>>>[-<<<++++>>>>>>>+<<<<]>>>>[-<<<<+>>>>]>>>>>>>>>>>>>>
+[-<<<++++>>>>>>>+<<<<]>>>>[-<<<<+>>>>]>>>>>>>>>>>>>>[-<<<++++>>>>>>>+<<<
+<]>>>>[-<<<<+>>>>]>>>>>>>>>>>>>>[-<<<++++>>>>>>>+<<<<]>>>>[-<<<<+>>>>]>>
+>>>>>>>>>>>>[-<<<++++>>>>>>>+<<<<]>>>>[-<<<<+>>>>]<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>+<<<<<]>
+>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]
+>[-<<<<<<<<<<<+>>>>>>>>>>>]>[->>>>>>+<<<<<<]>>>>>>[->>>>>+<<<<<]>>>>>[->
+>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<
+<<<<<<<+>>>>>>>>>>>]>[->>>>>>+<<<<<<]>>>>>>[->>>>>+<<<<<]>>>>>[->>>+<<<]
+>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<<
++>>>>>>>>>>>]>[->>>>>>+<<<<<<]>>>>>>[->>>>>+<<<<<]>>>>>[->>>+<<<]>>>>>++
+++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<<+>>>>>>
+>>>>>]>[->>>>>>+<<<<<<]>>>>>>[->>>>>+<<<<<]>>>>>[->>>+<<<]>>>>>+++++++++
++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<<+>>>>>>>>>>>]>
+[->>>>>>+<<<<<<]>>>>>>[->>>>>+<<<<<]>>>>>[->>>+<<<]>>>>>++++++++++<<[->+
+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<<+>>>>>>>>>>>]>[->>>>>
+>+<<<<<<]>>>>>>[->>>>>+<<<<<]>>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>
+]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<<+>>>>>>>>>>>]>[->>>>>>+<<<<<
+<]>>>>>>[->>>>>+<<<<<]>>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<
++>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<<+>>>>>>>>>>>]>[->>>>>>+<<<<<<]>>>>>
+>[->>>>>+<<<<<]>>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>
+]<<<<<<]>[-]>[-]>[-<<<<<<<<<<<+>>>>>>>>>>>]>[->>>>>>+<<<<<<]>>>>>>[->>>>
+>+<<<<<]>>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<
+]>[-]>[-]>[-<<<<<<<<<<<+>>>>>>>>>>>]>[->>>>>>+<<<<<<]>>>>>>[->>>>>+<<<<<
+]>>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[
+-]>[-<<<<<<<<<<<+>>>>>>>>>>>]>[->>>>>>+<<<<<<]>>>>>>[->>>>>+<<<<<]>>>>>[
+->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<
+<<<<<<<<<+>>>>>>>>>>>]>[->>>>>>+<<<<<<]>>>>>>[->>>>>+<<<<<]>>>>>[->>>+<<
+<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<
+<<+>>>>>>>>>>>]>[->>>>>>+<<<<<<]>>>>>>[->>>>>+<<<<<]>>>>>[->>>+<<<]>>>>>
+++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<<+>>>>
+>>>>>>>]>[->>>+<<<]>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++[->>>>>+<<
+<<<]>>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-
+]>[-]>[-<<<<<<<<<<<+>>>>>>>>>>>]>[->>>>>>+<<<<<<]>>>>>>[->>>>>+<<<<<]>>>
+>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[
+-<<<<<<<<<<<+>>>>>>>>>>>]>[->>>>>>+<<<<<<]>>>>>>[->>>>>+<<<<<]>>>>>[->>>
++<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<
+<<<<<+>>>>>>>>>>>]>[->>>>>>+<<<<<<]>>>>>>[->>>>>+<<<<<]>>>>>[->>>+<<<]>>
+>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<<+>
+>>>>>>>>>>]>[->>>>>>+<<<<<<]>>>>>>[->>>>>+<<<<<]>>>>>[->>>+<<<]>>>>>++++
+++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<<+>>>>>>>>
+>>>]>[->>>>>>+<<<<<<]>>>>>>[->>>>>+<<<<<]>>>>>[->>>+<<<]>>>>>++++++++++<
+<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<<+>>>>>>>>>>>]>[-
+>>>>>>+<<<<<<]>>>>>>[->>>>>+<<<<<]>>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-
+[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<<+>>>>>>>>>>>]>[->>>>>>+
+<<<<<<]>>>>>>[->>>>>+<<<<<]>>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>
+[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<<+>>>>>>>>>>>]>[->>>>>>+<<<<<<]
+>>>>>>[->>>>>+<<<<<]>>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>
+]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<<+>>>>>>>>>>>]>[->>>>>>+<<<<<<]>>>>>>[
+->>>>>+<<<<<]>>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<
+<<<<<]>[-]>[-]>[-<<<<<<<<<<<+>>>>>>>>>>>]>[->>>>>>+<<<<<<]>>>>>>[->>>>>+
+<<<<<]>>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>
+[-]>[-]>[-<<<<<<<<<<<+>>>>>>>>>>>]>[->>>>>>+<<<<<<]>>>>>>[->>>>>+<<<<<]>
+>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]
+>[-<<<<<<<<<<<+>>>>>>>>>>>]>[->>>>>>+<<<<<<]>>>>>>[->>>>>+<<<<<]>>>>>[->
+>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<
+<<<<<<<+>>>>>>>>>>>]>[->>>>>>+<<<<<<]>>>>>>[->>>>>+<<<<<]>>>>>[->>>+<<<]
+>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<<
++>>>>>>>>>>>]>[->>>+<<<]>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++[->>+<<]>>
+[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<
+<<<<<<<+>>>>>>>>]>[->>>>>>>>>+<<<<<<<<<]>>>>>>>>>[->>+<<]>>[->>>+<<<]>>>
+>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<+>>>>>
+>>>]>[->>>>>>>>>+<<<<<<<<<]>>>>>>>>>[->>+<<]>>[->>>+<<<]>>>>>++++++++++<
+<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<+>>>>>>>>]>[->>>>>>
+>>>+<<<<<<<<<]>>>>>>>>>[->>+<<]>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]
+>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<+>>>>>>>>]>[->>>>>>>>>+<<<<<<<<<
+]>>>>>>>>>[->>+<<]>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>
+]<<<<<<]>[-]>[-]>[-<<<<<<<<+>>>>>>>>]>[->>>>>>>>>+<<<<<<<<<]>>>>>>>>>[->
+>+<<]>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>
+[-]>[-<<<<<<<<+>>>>>>>>]>[->>>>>>>>>+<<<<<<<<<]>>>>>>>>>[->>+<<]>>[->>>+
+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<
+<+>>>>>>>>]>[->>>>>>>>>+<<<<<<<<<]>>>>>>>>>[->>+<<]>>[->>>+<<<]>>>>>++++
+++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<+>>>>>>>>]>[
+->>>>>>>>>+<<<<<<<<<]>>>>>>>>>[->>+<<]>>[->>>+<<<]>>>>>++++++++++<<[->+>
+-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<+>>>>>>>>]>[->>>+<<<]>>>[
+-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]]<[-]<<<[-]]>>>[<<<<<+++++++++++
++++++++++++++++++++++.[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->>>+>+<<<<]>>>>[
+-<<<<+>>>>]<[[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<]>>>[-<<<+>>>]>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>[[-]<++++++++++++++++++++++++++++++++++++++++++++++++<<[->>+
+>>+<<<<]>>>>[-<<<<+>>>>]<<.[-]>]<<<<<<<<<<<<<<<<<<<<<[->>>+>+<<<<]>>>>[-
+<<<<+>>>>]<[[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<]>>>[-<<<+>>>]>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[[-]<++++++++++++++++++++
+++++++++++++++++++++++++++++<<[->>+>>+<<<<]>>>>[-<<<<+>>>>]<<.[-]>]<<<<<
+<<<<<<<<<<<<<<<<[->>>+>+<<<<]>>>>[-<<<<+>>>>]<[[-]<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<]>>>[-<<<+>>>]>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[[-]<+++++++++++++++++++++
++++++++++++++++++++++++++++<<[->>+>>+<<<<]>>>>[-<<<<+>>>>]<<.[-]>]<<<<<<
+<<<<<<<<<<<<<<<[->>>+>+<<<<]>>>>[-<<<<+>>>>]<[[-]<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<]>>>[-<<<+>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>[[-]<++++++++++++++++++++++++++++++++++++++++++++++++<<[->>+>>+
+<<<<]>>>>[-<<<<+>>>>]<<.[-]>]<<<<<<<<<<<<<<<<<<<<<[->>>+>+<<<<]>>>>[-<<<
+<+>>>>]<[[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<]>>>[-<<<+>>>]>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>[[-]<++++++++++++++++++++++++++++++++++++++++++++++++<<[->>+>>+<
+<<<]>>>>[-<<<<+>>>>]<<.[-]>]<<<<<<<<<<<<<<<<<<<<<[->>>+>+<<<<]>>>>[-<<<<
++>>>>]<[[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<]>>>[-<<<+>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[[-]<++++++++++++++++++++++++
+++++++++++++++++++++++++<<[->>+>>+<<<<]>>>>[-<<<<+>>>>]<<.[-]>]<<<<<<<<<
+<<<<<<<<<<<<[->>>+>+<<<<]>>>>[-<<<<+>>>>]<[[-]<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<]>>>[-<<<+>>>]>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[[-]<+++++++++++++++++++++++++
++++++++++++++++++++++++<<[->>+>>+<<<<]>>>>[-<<<<+>>>>]<<.[-]>]<<<<<<<<<<
+<<<<<<<<<<<[->>>+>+<<<<]>>>>[-<<<<+>>>>]<[[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<+<<<]>>>[-<<<+>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>[[-]<++++++++++++++++++++++++++++++++++++++++++++++++<<[->>+>>+<<<<
+]>>>>[-<<<<+>>>>]<<.[-]>]<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++
+++++++++++++++++++++<<[->>+>>+<<<<]>>>>[-<<<<+>>>>]<<.[-]<<<<<<<<<<<<<<<
+<<<<[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>
+>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>
+>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>
+>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>
+>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<[-<+>>>>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>
+>>]>>>>>>>>>>[-<+>>>>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>>>>>>>
+>>[-<+>>>>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>>>>>>>>>[-<+>>>>>
+>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>>>>>>>>>[-<+>>>>>>>>>+<<<<<<
+<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>>>>>>>>>[-<+>>>>>>>>>+<<<<<<<<]>>>>>>>>
+[-<<<<<<<<+>>>>>>>>]>>>>>>>>>>[-<+>>>>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+
+>>>>>>>>]>>>>>>>>>>[-<+>>>>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>
+>>>>>>>>[-<+>>>>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>>>>>>>>>[-<
++>>>>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>>>>>>>>>[-<+>>>>>>>>>+
+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>>>>>>>>>[-<+>>>>>>>>>+<<<<<<<<]>>
+>>>>>>[-<<<<<<<<+>>>>>>>>]>>>>>>>>>>[-<+>>>>>>>>>+<<<<<<<<]>>>>>>>>[-<<<
+<<<<<+>>>>>>>>]>>>>>>>>>>[-<+>>>>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>
+>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]]>>>>>>>>>>>>>>>>>>
+>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>
+>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>
+>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>
+>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]]>>>>]>>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>
+>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]
+>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>
+>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>
+[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>+
+>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>>>[->>>+>>>>>>+<<
+<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>>>[->>>+>>>>>>+<<<<<<<<<]>
+>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>>>[->>>+>>>>>>+<<<<<<<<<]>>>>>>>>>[
+-<<<<<<<<<+>>>>>>>>>]>>>>>>>>>[->>>+>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<
+<+>>>>>>>>>]>>>>>>>>>[->>>+>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>
+>>]>>>>>>>>>[->>>+>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>
+>>>[->>>+>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>>>[->>>+
+>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>>>[->>>+>>>>>>+<<
+<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>>>[->>>+>>>>>>+<<<<<<<<<]>
+>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>>>[->>>+>>>>>>+<<<<<<<<<]>>>>>>>>>[
+-<<<<<<<<<+>>>>>>>>>]>>>>>>>>>[->>>+>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<
+<+>>>>>>>>>]>>>>>>>>>[->>>+>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>
+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++>>>>>>>>>>>>>>>>>>+++++++++>>>>>>>>>
+>>>>>>>>>+++++++++>>>>>>>>>>>>>>>>>>+++++++++>>>>>>>>>>>>>>>>>>+++++++++
+>>>>>>>>>>>>>>>>>>+++++++++>>>>>>>>>>>>>>>>>>+++++++++>>>>>>>>>>>>>>>>>>
++++++++++>>>>>>>>>>>>>>>>>>+++++++++>>>>>>>>>>>>>>>>>>+++++++++>>>>>>>>>
+>>>>>>>>>+++++++++>>>>>>>>>>>>>>>>>>+++++++++>>>>>>>>>>>>>>>>>>+++++++++
+>>>>>>>>>>>>>>>>>>+++++++++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>+<<<<]>>>>[->>>+<<<]>
+>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<+>
+>>>>>>>>>]>[->>>>>>>+<<<<<<<]>>>>>>>[->>>>+<<<<]>>>>[->>>+<<<]>>>>>+++++
++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<+>>>>>>>>>>
+]>[->>>>>>>+<<<<<<<]>>>>>>>[->>>>+<<<<]>>>>[->>>+<<<]>>>>>++++++++++<<[-
+>+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<+>>>>>>>>>>]>[->>>>>
+>>+<<<<<<<]>>>>>>>[->>>>+<<<<]>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>
+]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<+>>>>>>>>>>]>[->>>>>>>+<<<<<<
+<]>>>>>>>[->>>>+<<<<]>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>
+]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<+>>>>>>>>>>]>[->>>>>>>+<<<<<<<]>>>>>>>
+[->>>>+<<<<]>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<
+<<<]>[-]>[-]>[-<<<<<<<<<<+>>>>>>>>>>]>[->>>>>>>+<<<<<<<]>>>>>>>[->>>>+<<
+<<]>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>
+[-]>[-<<<<<<<<<<+>>>>>>>>>>]>[->>>>>>>+<<<<<<<]>>>>>>>[->>>>+<<<<]>>>>[-
+>>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<
+<<<<<<<+>>>>>>>>>>]>[->>>>>>>+<<<<<<<]>>>>>>>[->>>>+<<<<]>>>>[->>>+<<<]>
+>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<+>
+>>>>>>>>>]>[->>>>>>>+<<<<<<<]>>>>>>>[->>>>+<<<<]>>>>[->>>+<<<]>>>>>+++++
++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<+>>>>>>>>>>
+]>[->>>>>>>+<<<<<<<]>>>>>>>[->>>>+<<<<]>>>>[->>>+<<<]>>>>>++++++++++<<[-
+>+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<+>>>>>>>>>>]>[->>>>>
+>>+<<<<<<<]>>>>>>>[->>>>+<<<<]>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>
+]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<+>>>>>>>>>>]>[->>>>>>>+<<<<<<
+<]>>>>>>>[->>>>+<<<<]>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>
+]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<+>>>>>>>>>>]>[->>>>>>>+<<<<<<<]>>>>>>>
+[->>>>+<<<<]>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<
+<<<]>[-]>[-]>[-<<<<<<<<<<+>>>>>>>>>>]>[->>>+<<<]>>>[-]<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<[->>>>+>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<[[-]<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>[->>>>+>
+>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<[[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>
+>>>>>>[->>>>+>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<[[-]<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>[->>>>+>>+<<<<<<
+]>>>>>>[-<<<<<<+>>>>>>]<<[[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>[-
+>>>>+>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<[[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>[->>>>+>>+<<<<<<]>>>>>>[
+-<<<<<<+>>>>>>]<<[[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>[->>>>+>>+
+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<[[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>[->>>>+>>+<<<<<<]>>>>>>[-<<<<<<+
+>>>>>>]<<[[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>[->>>>+>>+<<<<<<]>
+>>>>>[-<<<<<<+>>>>>>]<<[[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>[->>>>+>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<
+<[[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>[->>>>+>>+<<<<<<]>>>>>>[-<
+<<<<<+>>>>>>]<<[[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>]>>>>>>>>>>>>>>[->>>>+>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<[[-]<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>[->>>>+>>+<<<<<<]>>>>>>[-<<<<<<+>>
+>>>>]<<[[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>]>>>>>>>>>>>>>>[->>>>+>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<[[-]<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>
+>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[
+-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>
+>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>
+>>[-]>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[<<
+++++++++++++++++++++++++++++++++.[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[[-]<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<]>>>[-<<<+>>>]>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>[[-]<++++++++++++++++++++++++++++++++++++++++++
+++++++<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<.[-
+]>]<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<
++>>>>>>>>>]<[[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<]>>>[-<<<+>>>]>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>[[-]<++++++++++++++++++++++++++++++++++++++++++++++++<<<<<<<
+[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<.[-]>]<<<<<<<<<<
+<<<<<<<<<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[
+[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<+<<<]>>>[-<<<+>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[[-]<++++++++++++++++++++++++++++++++
+++++++++++++++++<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>
+>>>>]<<.[-]>]<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[
+-<<<<<<<<<+>>>>>>>>>]<[[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<+<<<]>>>[-<<<+>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>[[-]<+++++++++++++++++++++++++++++++++++++++++++++
++++<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<.[-]>]
+<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>
+>>>>>>>]<[[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<]>>>
+[-<<<+>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[[-]<++++++++++++++++++++++
+++++++++++++++++++++++++++<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<
+<<<<+>>>>>>>>>]<<.[-]>]<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]
+>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<
+<]>>>[-<<<+>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[[-]<+++++++++++++++++++++++++++++++++++
++++++++++++++<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>
+>]<<.[-]>]<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<
+<<<<<<<+>>>>>>>>>]<[[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<]>>>[-<<<+>>>]>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[[-]<++++++++++++
+++++++++++++++++++++++++++++++++++++<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>
+>>>[-<<<<<<<<<+>>>>>>>>>]<<.[-]>]<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>+>+
+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[[-]<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<]>>>[-<<<+>>>]>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[[-]<+++++++++++++++++++++++++
++++++++++++++++++++++++<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<
+<+>>>>>>>>>]<<.[-]>]<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>
+>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[
+-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<+<<<]>>>[-<<<+>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[[-]<++
+++++++++++++++++++++++++++++++++++++++++++++++<<<<<<<[->>>>>>>+>>+<<<<<<
+<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<.[-]>]<<<<<<<<<<<<<<<<<<<<<<<<<<[->
+>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[[-]<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<+<<<]>>>[-<<<+>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[[-]<+++++++++++++++
++++++++++++++++++++++++++++++++++<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>
+[-<<<<<<<<<+>>>>>>>>>]<<.[-]>]<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>+>+<<<
+<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<]>>>[-<<<+
+>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>[[-]<++++++++++++++++++++++++++++++++++++++++++++++++<<<<<<<[->>>>>>>
++>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<.[-]>]<<<<<<<<<<<<<<<<<<<
+<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[[-]<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<]>>>[
+-<<<+>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[[-]<+++++
++++++++++++++++++++++++++++++++++++++++++++<<<<<<<[->>>>>>>+>>+<<<<<<<<<
+]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<.[-]>]<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>
+>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[[-]<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<]>>>[-<<<+>>>]>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>[[-]<++++++++++++++++++++++++++++++++++++++++++++++++<<<<<<
+<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<.[-]>]<<<<<<<<<
+<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++<<<<<<<[->>>>>
+>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<.[-]<<<<<<<<<<<<<<<<<<<
+[-]<<<<<<<<<<[-]]<<++++++++++.[-]>>>>>>>>>>>[-]>>>>>>>>>>>>>[-]>>>>>>>>>
+>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>
+[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>
+>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>
+>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>
+>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>
+>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>
+>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>
+>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>
+>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>
+>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>
+>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]]<<]
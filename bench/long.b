@@ -0,0 +1,20 @@
+Classic benchmark made of four levels of nested loops
+It prints a single byte with value 202
+
+>+>+>+>+>++<[>[<+++>-
+ >>>>>
+ >+>+>+>+>++<[>[<+++>-
+   >>>>>
+   >+>+>+>+>++<[>[<+++>-
+     >>>>>
+     >+>+>+>+>++<[>[<+++>-
+       >>>>>
+       +++[->+++++<]>[-]<
+       <<<<<
+     ]<<]>[-]
+     <<<<<
+   ]<<]>[-]
+   <<<<<
+ ]<<]>[-]
+ <<<<<
+]<<]>.
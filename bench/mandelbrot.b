@@ -0,0 +1,708 @@
+Draws the Mandelbrot set as ASCII art with ten's complement fixed point
+numbers of seven decimal digits each; every digit is kept in a cell of its own
+Points are marked by the iteration at which they escape (A is the first) and
+points that have not escaped after 26 iterations are left blank
+
+>>>>>>>>>>>>>>>>>>>[-]++++++>>>>>>>>>>>>>>>>>>>[-]++++++++>>>>>>>>>>>>>>
+>>>>>[-]++++++++>>>>>>>>>>>>>>>>>>>[-]+++++++++>>>>>>>>>>>>>>>>>>>[-]+++
+++++++>>>>>>>>>>>>>>>>>>>[-]+++++++++>>>>>>>>>>>>>>>>>>>[-]+++++++++<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++++++++++
++++++++++++++++++++++[>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>[-]+++++++++>>>>
+>>>>>>>>>>>>>>>[-]+++++++>>>>>>>>>>>>>>>>>>>[-]+++++++++>>>>>>>>>>>>>>>>
+>>>[-]+++++++++>>>>>>>>>>>>>>>>>>>[-]+++++++++>>>>>>>>>>>>>>>>>>>[-]++++
++++++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+++++++++
++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[<<
+<[-]+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++>>[
+-]++++++++++++++++++++++++++<[-]+[>>>>>>>>>>>>>>>>>[->>>>>>+>>+<<<<<<<<]
+>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[-<<<<<<[->>+>>>>>+<<<<<<<]>>>>>>>[-<<<<<<
+<+>>>>>>>]<]>>>>>>>>>>>>>[->>>>>>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>
+>]<<[-<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<+<<
+<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>[->>>>>>+
+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>[->>>>>>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<
++>>>>>>>>]<<[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<<<<<]>>>>>>>[-<<<<<<<
++>>>>>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>
+>>>>>>>[->>>>>>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[-<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>[->>>>>>+>>+<<<
+<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>
+>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>[->>>>>>+>>+<<<<<<<<]>>>>>>>>[-<<
+<<<<<<+>>>>>>>>]<<[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>+>>+
+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[->>>>>>>>>>>>>[->>+>>>>>+<<<<<<<
+]>>>>>>>[-<<<<<<<+>>>>>>>]<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>[->>>>>>+>>+
+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[-<<<<<<[->>>>>>>>>>>>>>>>>>>>>+<
+<<<<<<<<<<<<<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<]>>>>>>>>>>>>>[->>>>>>+>
+>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[-<<<<<<<<<<<<<<<<<<<<<<<<<[->>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
++<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>[->>>>
+>>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[-<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<<<<<]>>
+>>>>>[-<<<<<<<+>>>>>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>
+>>[->>>>>>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[-<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<<<<<]>>>>>>>[-
+<<<<<<<+>>>>>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+]>>>>>>>>>>>>>[->>>>>>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[-<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<<<<<]>>>>>>>[-<<<
+<<<<+>>>>>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>+<<<<]>>>>[->>>+<<<]>>
+>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<+>>
+>>>>>>>>]>[->>>>>>>>+<<<<<<<<]>>>>>>>>[->>>>+<<<<]>>>>[->>>+<<<]>>>>>+++
++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<+>>>>>>>>
+>>]>[->>>>>>>>+<<<<<<<<]>>>>>>>>[->>>>+<<<<]>>>>[->>>+<<<]>>>>>+++++++++
++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<+>>>>>>>>>>]>[-
+>>>>>>>>+<<<<<<<<]>>>>>>>>[->>>>+<<<<]>>>>[->>>+<<<]>>>>>++++++++++<<[->
++>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<+>>>>>>>>>>]>[->>>>>>
+>>+<<<<<<<<]>>>>>>>>[->>>>+<<<<]>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+
+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<+>>>>>>>>>>]>[->>>>>>>>+<<<
+<<<<<]>>>>>>>>[->>>>+<<<<]>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+
+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<+>>>>>>>>>>]>[->>>>>>>>+<<<<<<<<]
+>>>>>>>>[->>>>+<<<<]>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]
+>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<+>>>>>>>>>>]>[->>>+<<<]>>>[-]<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>+>>+<<<<<<<<]>>>
+>>>>>[-<<<<<<<<+>>>>>>>>]<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->>+>>>>>+
+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+]>>>>>>>>>>>>>[->>>>>>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[->>>>>
+>>>>>>>>[->>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<+<<<<<<<]>>>>>>>[-<<<<<<<+
+>>>>>>>]<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>[->>>>>>+>>+<<<<<<<<]>>>>>>>>[
+-<<<<<<<<+>>>>>>>>]<<[-<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<]>>>
+>>>>>>>>>>[->>>>>>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[-<<<<<<<<<
+<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<<<<<]>>>>>
+>>[-<<<<<<<+>>>>>>>]>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>[->>>>>>+>>+<<<<<<<<
+]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]
+<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->>+>>>>>+<<<<<<
+<]>>>>>>>[-<<<<<<<+>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<]>>>>>>>>>>>>>[->>>>>>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>
+>>>]<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->>>>>>>>>>>>>>>>>>>>>+<<<<<<<<
+<<<<<<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<]>>>>>>>>>>>>>[->>>>>>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<
+[->>>>>>>>>>>>>[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<<<<<<<<<<<<<<<<<<
+<]>>>>>>>>>>>>>[->>>>>>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[-<<<<
+<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<<<<<]>>>>>>>[-<<<<<<<+>>
+>>>>>]<]<<<<<<<<<<<<<<<<<<<<<<<[->>>>+<<<<]>>>>[->>>+<<<]>>>>>++++++++++
+<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<+>>>>>>>>>>]>[->
+>>>>>>>+<<<<<<<<]>>>>>>>>[->>>>+<<<<]>>>>[->>>+<<<]>>>>>++++++++++<<[->+
+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<+>>>>>>>>>>]>[->>>>>>>
+>+<<<<<<<<]>>>>>>>>[->>>>+<<<<]>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>
+>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<+>>>>>>>>>>]>[->>>>>>>>+<<<<
+<<<<]>>>>>>>>[->>>>+<<<<]>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[
+-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<+>>>>>>>>>>]>[->>>>>>>>+<<<<<<<<]>
+>>>>>>>[->>>>+<<<<]>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>
++>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<+>>>>>>>>>>]>[->>>+<<<]>>>[-]<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>+>>+<<<<<<<<]>>>>
+>>>>[-<<<<<<<<+>>>>>>>>]<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>[->>+>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<]>>>>>>>>>>>>>[->>>>>>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[->>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->>>>>>>>>>>>>>>>>>>>>
++<<<<<<<<<<<<<<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>[->>>>>>+>>+<<<<<<<<]>>
+>>>>>>[-<<<<<<<<+>>>>>>>>]<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<<<
+<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>+>>+<<<<<<<<]>>>>>>>>[-<
+<<<<<<<+>>>>>>>>]<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->>+>>>>>+<<<<<<<]>>>>>>>[-<<<<<<
+<+>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>[->>>>>>+>>+<<<<<<<<]>>>
+>>>>>[-<<<<<<<<+>>>>>>>>]<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>[->>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<+<<<<<<
+<]>>>>>>>[-<<<<<<<+>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>[->>>>+<<<<]>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+
+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<+>>>>>>>>>>]>[->>>>>>>>+<<<<<<<<]
+>>>>>>>>[->>>>+<<<<]>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]
+>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<+>>>>>>>>>>]>[->>>>>>>>+<<<<<<<<]>>>>>>
+>>[->>>>+<<<<]>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<
+<<<<<]>[-]>[-]>[-<<<<<<<<<<+>>>>>>>>>>]>[->>>+<<<]>>>[-]<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>+>>+<<<<<<<<]>>>>>>>>[
+-<<<<<<<<+>>>>>>>>]<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->>+>>>>>+<<
+<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->>>>+<<<<]>>>>[->>>+<<<]>>>>>
+++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<+>>>>>
+>>>>>]>[->>>+<<<]>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<
+<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<[
+-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<[-]>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<[-]>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
++>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<[->>>>+>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<[->>>+<<<]>>>>>+++++<<[->
++>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[->>>>+<<<<]>[->>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>[-]>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<+++++++++>>>>>>>>>>>>>>>>>>>+++++++
+++>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>+>>+<<<<<
+<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<[-<<<<<[->>+>>>>+<<<<<<]>>>>>>[-<<<<<<+>>>
+>>>]<]>>>>>>>>>>>>>>[->>>>>+>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<[-<<<<
+<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<+<<<<<<]>>>>>
+>[-<<<<<<+>>>>>>]>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>[->>>>>+>>+<<<<<<<]>>>
+>>>>[-<<<<<<<+>>>>>>>]<<[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>
+>>>>>>>>>>>>[->>>>>+>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<[-<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>[->>>>>+>>+<<<<<<<]>>>
+>>>>[-<<<<<<<+>>>>>>>]<<[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<<<<]>>>>>>[-<<<<<<+>>>>>
+>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>]>>>>>>>>>>>>>>[->>>>>+>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<[-<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+
+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>[->>>>
+>+>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<[->>>>>+>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<[->>>>>>>>>>>>>>[->>+
+>>>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[->
+>>>>+>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<[-<<<<<[->>>>>>>>>>>>>>>>>>>>
+>+<<<<<<<<<<<<<<<+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<]>>>>>>>>>>>>>>[->>>>>+>
+>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<[-<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<
+<<<]>>>>>>[-<<<<<<+>>>>>>]>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>[->>>>>+>>+<<
+<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<<<<]>>>>>>[-<<<<<<+
+>>>>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>[->>>>>+>>+<<
+<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>[->>>>>+>
+>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<[->>>+<<<]>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]
+>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<+>>>>>>>>>]>[->>>>>>>>>+<<<<<<<<<]>>>>>>
+>>>[->>>+<<<]>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<
+<<<]>[-]>[-]>[-<<<<<<<<<+>>>>>>>>>]>[->>>>>>>>>+<<<<<<<<<]>>>>>>>>>[->>>
++<<<]>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]
+>[-]>[-<<<<<<<<<+>>>>>>>>>]>[->>>>>>>>>+<<<<<<<<<]>>>>>>>>>[->>>+<<<]>>>
+[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<
+<<<<<<<<+>>>>>>>>>]>[->>>>>>>>>+<<<<<<<<<]>>>>>>>>>[->>>+<<<]>>>[->>>+<<
+<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<
++>>>>>>>>>]>[->>>>>>>>>+<<<<<<<<<]>>>>>>>>>[->>>+<<<]>>>[->>>+<<<]>>>>>+
++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<+>>>>>>>
+>>]>[->>>>>>>>>+<<<<<<<<<]>>>>>>>>>[->>>+<<<]>>>[->>>+<<<]>>>>>+++++++++
++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<+>>>>>>>>>]>[->>
+>+<<<]>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->
+>>>>+>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>[->>+>>>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<]>>>>>>>>>>>>>>[->>>>>+>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<
+<[->>>>>>>>>>>>>>[->>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<+<<<<<<]>>>>>>[-
+<<<<<<+>>>>>>]<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[->>>>>+>>+<<<<<<<]>>>>
+>>>[-<<<<<<<+>>>>>>>]<<[-<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<]>>>>>
+>>>>>>>>>[->>>>>+>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<[-<<<<<<<<<<<<<<<
+<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<<<<]>>>>>>[-<<<<
+<<+>>>>>>]>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>[->>>>>+>>+<<<<<<<]>>>>>>>[-<
+<<<<<<+>>>>>>>]<<[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+
+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<[->>>>>+>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<[->>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->>+>>>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>
+[->>>>>+>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<[->>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>[->>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<+<<<<<<]>>>>>>[-<<<<<<+>
+>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[->>>>>+>>+<
+<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<[->>>>>>>>>>>>>>[->>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<<<<]>>>>>>[-<
+<<<<<+>>>>>>]<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[->>>>>+>>+<<<<<<<]>>>>>
+>>[-<<<<<<<+>>>>>>>]<<[-<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
++<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<]<<<<<<<<<<<<<<<<<<<<<<[->>>+<<<]>>>[->>>
++<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<
+<<<+>>>>>>>>>]>[->>>>>>>>>+<<<<<<<<<]>>>>>>>>>[->>>+<<<]>>>[->>>+<<<]>>>
+>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<+>>>>
+>>>>>]>[->>>>>>>>>+<<<<<<<<<]>>>>>>>>>[->>>+<<<]>>>[->>>+<<<]>>>>>++++++
+++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<+>>>>>>>>>]>[
+->>>>>>>>>+<<<<<<<<<]>>>>>>>>>[->>>+<<<]>>>[->>>+<<<]>>>>>++++++++++<<[-
+>+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<+>>>>>>>>>]>[->>>>>>>
+>>+<<<<<<<<<]>>>>>>>>>[->>>+<<<]>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>
+>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<+>>>>>>>>>]>[->>>+<<<]>>>[-]<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>+>>+<<<<<
+<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->>+>>>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<]>>>>>>>>>>>>>>[->>>>>+>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<[->>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->>>>>>>>>>>>>>>>>>>>>+<<
+<<<<<<<<<<<<<+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[->>>>>+>>+<<<<<<<]>>>>>>>[-
+<<<<<<<+>>>>>>>]<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<<<<]>>>>>>
+[-<<<<<<+>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>+>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<
+<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>[->>+>>>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<]>>>>>>>>>>>>>>[->>>>>+>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<
+<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>[->>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->>>+<<<]>>>
+[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<
+<<<<<<<<+>>>>>>>>>]>[->>>>>>>>>+<<<<<<<<<]>>>>>>>>>[->>>+<<<]>>>[->>>+<<
+<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<
++>>>>>>>>>]>[->>>>>>>>>+<<<<<<<<<]>>>>>>>>>[->>>+<<<]>>>[->>>+<<<]>>>>>+
++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<+>>>>>>>
+>>]>[->>>+<<<]>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<[->>>>>+>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<[->>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>[->>+>>>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->>
+>+<<<]>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-
+]>[-]>[-<<<<<<<<<+>>>>>>>>>]>[->>>+<<<]>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>]<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+]<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<
+<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<
+<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<[->>>+<<<
+]>>>>>+++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[->>>>+<<<<]>[->>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>[-]>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+++++++++>>>>>>>>>>>
+>>>>>>>>+++++++++>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>
+>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>[-]++++>>>>>>>>>>>>>>>>>>>[-]>>>>>
+>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++<<<[->>>->>>+<<<<<<]>>>>>>[-<<<<
+<<+>>>>>>]>>>>>>>>>>>>>>>>+++++++++<<<[->>>->>>+<<<<<<]>>>>>>[-<<<<<<+>>
+>>>>]>>>>>>>>>>>>>>>>+++++++++<<<[->>>->>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]
+>>>>>>>>>>>>>>>>+++++++++<<<[->>>->>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>>>
+>>>>>>>>>>>+++++++++<<<[->>>->>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>>>>>>>>
+>>>>>>+++++++++<<<[->>>->>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>>>>>>>>>>>>>
+>+++++++++<<<[->>>->>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<+[->+<]>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]
+>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<+>>>>>>>]>[->>>>>>>>>>>+<<<<<<<<<
+<<]>>>>>>>>>>>[->+<]>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>
+>]<<<<<<]>[-]>[-]>[-<<<<<<<+>>>>>>>]>[->>>>>>>>>>>+<<<<<<<<<<<]>>>>>>>>>
+>>[->+<]>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-
+]>[-]>[-<<<<<<<+>>>>>>>]>[->>>>>>>>>>>+<<<<<<<<<<<]>>>>>>>>>>>[->+<]>[->
+>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<
+<<<+>>>>>>>]>[->>>>>>>>>>>+<<<<<<<<<<<]>>>>>>>>>>>[->+<]>[->>>+<<<]>>>>>
+++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<+>>>>>>>]
+>[->>>>>>>>>>>+<<<<<<<<<<<]>>>>>>>>>>>[->+<]>[->>>+<<<]>>>>>++++++++++<<
+[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<+>>>>>>>]>[->>>>>>>>>
+>>+<<<<<<<<<<<]>>>>>>>>>>>[->+<]>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]
+>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<+>>>>>>>]>[->>>+<<<]>>>[-]<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++<<[->>->>>+<<<<<]
+>>>>>[-<<<<<+>>>>>]>>>>>>>>>>>>>>>>+++++++++<<[->>->>>+<<<<<]>>>>>[-<<<<
+<+>>>>>]>>>>>>>>>>>>>>>>+++++++++<<[->>->>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>
+>>>>>>>>>>>>>+++++++++<<[->>->>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>>>>>>>>>>>
+>>+++++++++<<[->>->>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>>>>>>>>>>>>>+++++++++
+<<[->>->>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>>>>>>>>>>>>>+++++++++<<[->>->>>+
+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+[
+->+<]>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[
+-]>[-<<<<<<<+>>>>>>>]>[->>>>>>>>>>>+<<<<<<<<<<<]>>>>>>>>>>>[->+<]>[->>>+
+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<
++>>>>>>>]>[->>>>>>>>>>>+<<<<<<<<<<<]>>>>>>>>>>>[->+<]>[->>>+<<<]>>>>>+++
++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<+>>>>>>>]>[-
+>>>>>>>>>>>+<<<<<<<<<<<]>>>>>>>>>>>[->+<]>[->>>+<<<]>>>>>++++++++++<<[->
++>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<+>>>>>>>]>[->>>>>>>>>>>+
+<<<<<<<<<<<]>>>>>>>>>>>[->+<]>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+
+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<+>>>>>>>]>[->>>>>>>>>>>+<<<<<<<<<<<]
+>>>>>>>>>>>[->+<]>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<
+<<<<<]>[-]>[-]>[-<<<<<<<+>>>>>>>]>[->>>>>>>>>>>+<<<<<<<<<<<]>>>>>>>>>>>[
+->+<]>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[
+-]>[-<<<<<<<+>>>>>>>]>[->>>+<<<]>>>[-]<<<<<<<<<<<[->+>>+<<<]>>>[-<<<+>>>
+]<<[->>>+<<<]>>>>>+++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[->>>
+>+<<<<]>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>]>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<[-]>>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>[
+-]>>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>[-]<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<[>>>[-]<
+<[-]<[-]]>[>>>>>>>>>>>>>>>>>>>[->>>>>>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>
+>>>>>>]<<[-<<<<<[->>>+>>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<]>>>>>>>>>>>>>[-
+>>>>>>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[-<<<<<<<<<<<<<<<<<<<<<
+<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<+<<<<<<]>>>>>>[-<<<<<<+>>>>>
+>]>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>[->>>>>>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<
+<+>>>>>>>>]<<[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<<<<
+]>>>>>>[-<<<<<<+>>>>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>
+>>[->>>>>>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[-<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>[->>>>>>+>>+<<<<<<<<]>>>>>
+>>>[-<<<<<<<<+>>>>>>>>]<<[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<<<<]>>>>>>[-<<<<<<+>>
+>>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>]>>>>>>>>>>>>>[->>>>>>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<
+<[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>
+>>[->>>>>>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[-<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<<<<]>>>>>>[-<<<<<<+>>>>
+>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<[->>>>>>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<
+[->>>>>>>>>>>>>>[->>>+>>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<<<<<<<<<<<<<<<<
+<<<]>>>>>>>>>>>>>[->>>>>>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[-<<
+<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<+<<<<<<]>>>>>>[-<<<<<<+>>>>>
+>]<]>>>>>>>>>>>>>[->>>>>>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[-<<
+<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>>>>>>>>>>>
+>>>>>]>>>>>>>>>>>>>[->>>>>>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>]>>>>>>>>>>>>>[->>>>>>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>
+>]<<[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>[->>>>>>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<
+<<+>>>>>>>>]<<[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>+<<]>>[
+->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<
+<<<<<<+>>>>>>>>]>[->>>>>>>>>>+<<<<<<<<<<]>>>>>>>>>>[->>+<<]>>[->>>+<<<]>
+>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<+>>>
+>>>>>]>[->>>>>>>>>>+<<<<<<<<<<]>>>>>>>>>>[->>+<<]>>[->>>+<<<]>>>>>++++++
+++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<+>>>>>>>>]>[->
+>>>>>>>>>+<<<<<<<<<<]>>>>>>>>>>[->>+<<]>>[->>>+<<<]>>>>>++++++++++<<[->+
+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<+>>>>>>>>]>[->>>>>>>>>>+
+<<<<<<<<<<]>>>>>>>>>>[->>+<<]>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[
++[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<+>>>>>>>>]>[->>>>>>>>>>+<<<<<<<<<<
+]>>>>>>>>>>[->>+<<]>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>
+>]<<<<<<]>[-]>[-]>[-<<<<<<<<+>>>>>>>>]>[->>>>>>>>>>+<<<<<<<<<<]>>>>>>>>>
+>[->>+<<]>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>
+[-]>[-]>[-<<<<<<<<+>>>>>>>>]>[->>>+<<<]>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>
+>>>>>>>]<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->>>+>>>+<<<<<<]>>>>>>[-<<
+<<<<+>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>[->>>>>
+>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[->>>>>>>>>>>>>>[->>>>>>>>>>
+>>>>>>>>>>>>+<<<<<<<<<<<<<<<<+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<<<<<<<<<<<<
+<<<<<<<]>>>>>>>>>>>>>[->>>>>>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<
+[-<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<]>>>>>>>>>>>>>[->>>>>>+>>+<
+<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[-<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>>>
+>>>>>>>>>>>>>]>>>>>>>>>>>>>[->>>>>>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>
+>>>]<<[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<<<<]>>
+>>>>[-<<<<<<+>>>>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>
+>>>>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[->>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->>>+>>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>[->>
+>>>>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[->>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<+<<<<<<]>>>>>>[-<<<<<
+<+>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>[->>>>>>+>
+>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[->>>>>>>>>>>>>>[->>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<<<<]
+>>>>>>[-<<<<<<+>>>>>>]<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>[->>>>>>+>>+<<<<
+<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[-<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<]<<<<<<<<<<<<<<<<<<<<<[->>
++<<]>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[
+-]>[-<<<<<<<<+>>>>>>>>]>[->>>>>>>>>>+<<<<<<<<<<]>>>>>>>>>>[->>+<<]>>[->>
+>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<
+<<<+>>>>>>>>]>[->>>>>>>>>>+<<<<<<<<<<]>>>>>>>>>>[->>+<<]>>[->>>+<<<]>>>>
+>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<+>>>>>>
+>>]>[->>>>>>>>>>+<<<<<<<<<<]>>>>>>>>>>[->>+<<]>>[->>>+<<<]>>>>>+++++++++
++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<+>>>>>>>>]>[->>>>
+>>>>>>+<<<<<<<<<<]>>>>>>>>>>[->>+<<]>>[->>>+<<<]>>>>>++++++++++<<[->+>-[
+>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<+>>>>>>>>]>[->>>+<<<]>>>[-]
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>+>>+<<
+<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->>>+>>>+<<<<<<]>>>>>>[-<<<<<<+>>
+>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<]>>>>>>>>>>>>>[->>>>>>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>
+]<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->>>>>>>>>>>>>
+>>>>>>>>>+<<<<<<<<<<<<<<<<+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>[->>>>>>+>>+<<<<
+<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>+>>+<<<<<<<<]>>>>
+>>>>[-<<<<<<<<+>>>>>>>>]<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->>>+>>>+<<<<<<]>>>>>>[-<
+<<<<<+>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>[->>>>>>+>>+<<<<<<<<]
+>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<
++<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>[->>+<<]>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[
+-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<+>>>>>>>>]>[->>>>>>>>>>+<<<<<<<<<<]>
+>>>>>>>>>[->>+<<]>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]
+<<<<<<]>[-]>[-]>[-<<<<<<<<+>>>>>>>>]>[->>>>>>>>>>+<<<<<<<<<<]>>>>>>>>>>[
+->>+<<]>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-
+]>[-]>[-<<<<<<<<+>>>>>>>>]>[->>>+<<<]>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>
+>>>>>]<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->>>+>>>+<<<<<<]>>>>>>[-
+<<<<<<+>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>[->>+<<]>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+
+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<+>>>>>>>>]>[->>>+<<<]>>>[-]<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>+>>+<<<<]>>>>[-<<
+<<+>>>>]<<[->>>+<<<]>>>>>+++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-
+]>[->>>>+<<<<]>[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<]>>>[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<++
++++++++>>>>>>>>>>>>>>>>>>>+++++++++>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>
+>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>
+>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>+>>>>>>>+<<<<<<<<<
+]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>>>>[->>+>>>>>>>+<<<<<<<<<]>>>>>>>
+>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>>>>[->>+>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<
+<<<<<+>>>>>>>>>]>>>>>>>>>>[->>+>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>
+>>>>>>>]>>>>>>>>>>[->>+>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]
+>>>>>>>>>>[->>+>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>>
+>>[->>+>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-<<<++>>>>>>>+<<<<]>>>>[-<<<<+>>>>]>>>>>>
+>>>>>>>>>[-<<<++>>>>>>>+<<<<]>>>>[-<<<<+>>>>]>>>>>>>>>>>>>>>[-<<<++>>>>>
+>>+<<<<]>>>>[-<<<<+>>>>]>>>>>>>>>>>>>>>[-<<<++>>>>>>>+<<<<]>>>>[-<<<<+>>
+>>]>>>>>>>>>>>>>>>[-<<<++>>>>>>>+<<<<]>>>>[-<<<<+>>>>]>>>>>>>>>>>>>>>[-<
+<<++>>>>>>>+<<<<]>>>>[-<<<<+>>>>]>>>>>>>>>>>>>>>[-<<<++>>>>>>>+<<<<]>>>>
+[-<<<<+>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>+<<<
+<<]>>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]
+>[-]>[-<<<<<<<<<<<+>>>>>>>>>>>]>[->>>>>>>+<<<<<<<]>>>>>>>[->>>>>+<<<<<]>
+>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]
+>[-<<<<<<<<<<<+>>>>>>>>>>>]>[->>>>>>>+<<<<<<<]>>>>>>>[->>>>>+<<<<<]>>>>>
+[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<
+<<<<<<<<<<+>>>>>>>>>>>]>[->>>>>>>+<<<<<<<]>>>>>>>[->>>>>+<<<<<]>>>>>[->>
+>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<
+<<<<<<+>>>>>>>>>>>]>[->>>>>>>+<<<<<<<]>>>>>>>[->>>>>+<<<<<]>>>>>[->>>+<<
+<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<
+<<+>>>>>>>>>>>]>[->>>>>>>+<<<<<<<]>>>>>>>[->>>>>+<<<<<]>>>>>[->>>+<<<]>>
+>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<<+>
+>>>>>>>>>>]>[->>>>>>>+<<<<<<<]>>>>>>>[->>>>>+<<<<<]>>>>>[->>>+<<<]>>>>>+
++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<<+>>>>>
+>>>>>>]>[->>>+<<<]>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<[-]>>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>
+[-]>>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>[-]<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>[-]>>>>
+>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>
+>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<[->>+>>>>>>>>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]>>>>>>>
+>>[->>+>>>>>>>>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]>>>>>>>>>[-
+>>+>>>>>>>>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]>>>>>>>>>[->>+>
+>>>>>>>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]>>>>>>>>>[->>+>>>>>
+>>>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]>>>>>>>>>[->>+>>>>>>>>+
+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]>>>>>>>>>[->>+>>>>>>>>+<<<<
+<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<[-<<+>>>>>>>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>>>>>>>>>>
+>[-<<+>>>>>>>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>>>>>>>>>>>[-<<+>>>>>>>>+<
+<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>>>>>>>>>>>[-<<+>>>>>>>>+<<<<<<]>>>>>>[-<<
+<<<<+>>>>>>]>>>>>>>>>>>>>[-<<+>>>>>>>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>>
+>>>>>>>>>[-<<+>>>>>>>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>>>>>>>>>>>[-<<+>>
+>>>>>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<[->>>>>>+<<<<<<]>>>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+
+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>[->>>>>>+<
+<<<<<]>>>>>>[->>>>>>+<<<<<<]>>>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>
+]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>[->>>>>>+<<<
+<<<]>>>>>>[->>>>>>+<<<<<<]>>>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>
+[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>[->>>>>>+<<<<<
+<]>>>>>>[->>>>>>+<<<<<<]>>>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+
+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>[->>>>>>+<<<<<<]
+>>>>>>[->>>>>>+<<<<<<]>>>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-
+<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>[->>>>>>+<<<<<<]>>
+>>>>[->>>>>>+<<<<<<]>>>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+
+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>[->>>>>>+<<<<<<]>>>>
+>>[->>>>>>+<<<<<<]>>>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]
+>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>[->>>+<<<]>>>[-]<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++>>>[-<<<->>
+>>>>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>>>>>>>>+++++++++>>>[-<<<->>>>>>>>+<<
+<<<]>>>>>[-<<<<<+>>>>>]>>>>>>>>>>>+++++++++>>>[-<<<->>>>>>>>+<<<<<]>>>>>
+[-<<<<<+>>>>>]>>>>>>>>>>>+++++++++>>>[-<<<->>>>>>>>+<<<<<]>>>>>[-<<<<<+>
+>>>>]>>>>>>>>>>>+++++++++>>>[-<<<->>>>>>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>
+>>>>>>>+++++++++>>>[-<<<->>>>>>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>>>>>>>>++
++++++++>>>[-<<<->>>>>>>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<+[->>>>>>+<<<<<<]>>>>>>[->>>+<<<]>>>>>++++++
+++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<<<+>>>>>>>>>
+>>>]>[->>>>>>+<<<<<<]>>>>>>[->>>>>>+<<<<<<]>>>>>>[->>>+<<<]>>>>>++++++++
+++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<<<+>>>>>>>>>>>
+>]>[->>>>>>+<<<<<<]>>>>>>[->>>>>>+<<<<<<]>>>>>>[->>>+<<<]>>>>>++++++++++
+<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<<<+>>>>>>>>>>>>]
+>[->>>>>>+<<<<<<]>>>>>>[->>>>>>+<<<<<<]>>>>>>[->>>+<<<]>>>>>++++++++++<<
+[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>[
+->>>>>>+<<<<<<]>>>>>>[->>>>>>+<<<<<<]>>>>>>[->>>+<<<]>>>>>++++++++++<<[-
+>+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>[->
+>>>>>+<<<<<<]>>>>>>[->>>>>>+<<<<<<]>>>>>>[->>>+<<<]>>>>>++++++++++<<[->+
+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>[->>>
+>>>+<<<<<<]>>>>>>[->>>>>>+<<<<<<]>>>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-
+[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>[->>>+<
+<<]>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<+>>-[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<+>>>>>>>[[-]
+<<<<<<<->>>>>>>]<<<<<<<[>>>[-]<[-]++++++++++++++++++++++++++++++++<<[-]]
+>[-]]>>>>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>[-
+]>>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>[-]>>>>>
+>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>
+>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>
+>>[-]>>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]<.[-]>>[-]>>>>>>>>>>>>>>>>[-]>>>
+>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>
+>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>[-
+]>>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>[-]>>>>>
+>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++[->>>>
+>>>>+<<<<<<<<]>>>>>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+
+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>[->>>>+<<<<]>>>>[->>
+>>>>>>+<<<<<<<<]>>>>>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]
+>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>[->>>>+<<<<]>>>>[-
+>>>>>>>>+<<<<<<<<]>>>>>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+
+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>[->>>>+<<<<]>>>>
+[->>>>>>>>+<<<<<<<<]>>>>>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-
+<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>[->>>>+<<<<]>>
+>>[->>>>>>>>+<<<<<<<<]>>>>>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+
+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>[->>>>+<<<<]
+>>>>[->>>>>>>>+<<<<<<<<]>>>>>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>
+[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>[->>>>+<<<
+<]>>>>[->>>>>>>>+<<<<<<<<]>>>>>>>>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>
+]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>[->>>+<<
+<]>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<-]>>[-]++++++++++.[-]>>>>>>>>>>>>++++++[->>>>>>>+<<<<<<<]>>>>>>
+>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-
+<<<<<<<<<<<<<+>>>>>>>>>>>>>]>[->>>>>+<<<<<]>>>>>[->>>>>>>+<<<<<<<]>>>>>>
+>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-
+<<<<<<<<<<<<<+>>>>>>>>>>>>>]>[->>>>>+<<<<<]>>>>>[->>>>>>>+<<<<<<<]>>>>>>
+>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-
+<<<<<<<<<<<<<+>>>>>>>>>>>>>]>[->>>>>+<<<<<]>>>>>[->>>>>>>+<<<<<<<]>>>>>>
+>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-
+<<<<<<<<<<<<<+>>>>>>>>>>>>>]>[->>>>>+<<<<<]>>>>>[->>>>>>>+<<<<<<<]>>>>>>
+>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-
+<<<<<<<<<<<<<+>>>>>>>>>>>>>]>[->>>>>+<<<<<]>>>>>[->>>>>>>+<<<<<<<]>>>>>>
+>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-
+<<<<<<<<<<<<<+>>>>>>>>>>>>>]>[->>>>>+<<<<<]>>>>>[->>>>>>>+<<<<<<<]>>>>>>
+>[->>>+<<<]>>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-
+<<<<<<<<<<<<<+>>>>>>>>>>>>>]>[->>>+<<<]>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]
@@ -0,0 +1,14 @@
+Repeatedly multiplies two cells with a nested multiply loop and prints a zero
+
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++[>>>>>++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++[>+++++++++++++++++++++++++++++++++++++>++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++++++++++++++++++<[>[->+>+<<]>>[-<<+>>]<<<-]>[-]>[-]<<<-]<<<<<
+-]>>>>>>>>>+<>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>>>>
+++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>>[++++++++++++++++
+++++++++++++++++++++++++++++++++.[-]>+<]<[->>>+>+<<<<]>>>>[-<<<<+>>>>]<[
+[-]<[-]+>]<[<<++++++++++++++++++++++++++++++++++++++++++++++++.>>[-]]<<[
+-]<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]
@@ -0,0 +1,16 @@
+Prints the numbers from 1 to 255 in decimal two hundred and fifty times
+Every number is split into digits with the common divmod by ten snippet
+
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++[>>+++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++[<+[->>>+<+<<]>>[-<<+>>]>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<
+<<<]>[-]>[-]>>>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>>[
+++++++++++++++++++++++++++++++++++++++++++++++++.[-]>+<]<[->>>+>+<<<<]>>
+>>[-<<<<+>>>>]<[[-]<[-]+>]<[<<++++++++++++++++++++++++++++++++++++++++++
+++++++.>>[-]]<<[-]<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[
+-]<<<++++++++++.[-]<<-]<[-]<-]
@@ -0,0 +1,47 @@
+#!/bin/sh
+# Run every program in bench/ through `codegen --bench` and print a single
+# JSON document with the results, tagged with the current commit and the
+# extra flags.
+#
+# usage: bench/run.sh [path to codegen] [extra codegen flags...] > results.json
+#
+# Extra flags are passed on to codegen, so different configurations can be
+# compared by running the script once per configuration.
+#
+# The script fails if the AST passes take longer than MAX_AST_PASSES_MS
+# (1000 by default) on any program, they are meant to be cheap next to
+# the rest of the compiler.
+CODEGEN=${1:-./codegen}
+[ $# -gt 0 ] && shift
+BENCH_DIR=$(dirname "$0")
+MAX_AST_PASSES_MS=${MAX_AST_PASSES_MS:-1000}
+STATUS=0
+COMMIT=$(git -C "$BENCH_DIR" rev-parse --short HEAD 2>/dev/null || echo unknown)
+
+# Print a JSON string holding $1
+json_string() {
+    printf '"%s"' "$(printf '%s' "$1" | sed -e 's/\\/\\\\/g' -e 's/"/\\"/g' | sed -e ':a' -e 'N' -e '$!ba' -e 's/\n/\\n/g')"
+}
+
+printf '{"commit":%s,"flags":[' "$(json_string "$COMMIT")"
+separator=""
+for flag in "$@"; do
+    printf '%s%s' "$separator" "$(json_string "$flag")"
+    separator=","
+done
+printf '],"results":[\n'
+separator=""
+for program in "$BENCH_DIR"/*.b; do
+    printf '%s' "$separator"
+    result=$("$CODEGEN" --bench --bench-runs "${BENCH_RUNS:-3}" "$@" "$program")
+    printf '%s\n' "$result"
+    separator=","
+
+    ast_passes_ms=$(printf '%s' "$result" | sed -n 's/.*"ast_passes_ms":\([0-9.e+-]*\).*/\1/p')
+    if [ -n "$ast_passes_ms" ] && awk -v ms="$ast_passes_ms" -v max="$MAX_AST_PASSES_MS" 'BEGIN { exit !(ms > max) }'; then
+        echo "$program: AST passes took $ast_passes_ms ms, more than $MAX_AST_PASSES_MS ms" >&2
+        STATUS=1
+    fi
+done
+printf ']}\n'
+exit $STATUS
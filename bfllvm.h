@@ -0,0 +1,87 @@
+// Embedding API of the brainfuck compiler, for programs that want to
+// compile and run brainfuck in-process instead of spawning `codegen`.
+//
+// Build codegen.cpp with -DBFLLVM_LIBRARY to get the library (see README.md).
+// This header does not depend on LLVM, and its C part declares the entry
+// point of programs compiled with `codegen --entry`.
+#ifndef BFLLVM_H
+#define BFLLVM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// The I/O channel of a program compiled with `codegen --entry`. `put`
+// gets the cells the program prints and `get` returns its input, or
+// -1 at the end of it. Both get `context` as their first argument.
+struct bf_io {
+    void *context;
+    int (*put)(void *context, int c);
+    int (*get)(void *context);
+};
+
+// What bf_run() returns when a program compiled with --bounds-check
+// tried to access a cell off the tape
+#define BF_OVERRUN ((size_t)-1)
+
+// The function `codegen --entry` emits. Runs the program with the head
+// on cell `position` of `tape`, which has --tape-size cells, and returns
+// the position it ends on, or BF_OVERRUN. It keeps no state of its own,
+// so threads can run it at the same time on their own tapes and channels.
+size_t bf_run(uint8_t *tape, size_t position, struct bf_io *io);
+
+#ifdef __cplusplus
+}
+
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string>
+
+namespace bfllvm {
+
+// The subset of the command line options that applies to embedded programs
+struct Options {
+    bool promote_cells = true;
+    bool ast_passes = true;
+
+    // Return from run() with an error instead of accessing a cell off the tape
+    bool bounds_check = false;
+
+    // Number of cells of the tapes programs run on
+    uint64_t tape_size = 0x10000;
+
+    unsigned outline_threshold = 4000;
+};
+
+class CompiledProgram {
+public:
+    struct State;
+
+    explicit CompiledProgram(std::unique_ptr<State> state);
+    ~CompiledProgram();
+
+    // The number of cells the tape passed to run() must have
+    uint64_t tape_size() const;
+
+    // Run the program with the head on the first cell of `tape`, reading
+    // its input from `in` and writing its output to `out`. Returns false
+    // if a bounds check failed, in which case the message is in `error`.
+    // Different threads may run the same program at the same time.
+    bool run(uint8_t *tape, std::istream &in, std::ostream &out, std::string &error) const;
+
+private:
+    std::unique_ptr<State> state;
+};
+
+// Compile a program to native code. Returns null and sets `error` if the
+// program can't be compiled. Calls from different threads take turns.
+std::unique_ptr<CompiledProgram> compile(const std::string &source, const Options &options, std::string &error);
+
+}
+#endif
+
+#endif
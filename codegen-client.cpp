@@ -0,0 +1,134 @@
+// Thin client for the compile server started with `codegen --serve <socket>`.
+//
+// This deliberately does not link against LLVM, so that starting it costs
+// next to nothing compared to starting the compiler itself.
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+static bool write_all(int fd, const char *buffer, size_t size) {
+    while (size > 0) {
+        ssize_t n = write(fd, buffer, size);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        buffer += n;
+        size -= n;
+    }
+    return true;
+}
+
+static int connect_to(const char *path) {
+    sockaddr_un address = {};
+    address.sun_family = AF_UNIX;
+    if (strlen(path) >= sizeof(address.sun_path)) {
+        return -1;
+    }
+    strcpy(address.sun_path, path);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || connect(fd, (sockaddr *)&address, sizeof(address)) < 0) {
+        return -1;
+    }
+    return fd;
+}
+
+int main(int argc, char **argv) {
+    if (argc != 4 || (strcmp(argv[2], "compile") != 0 && strcmp(argv[2], "run") != 0)) {
+        std::cerr << "usage: " << argv[0] << " <socket> (compile|run) <input file>" << std::endl;
+        return -1;
+    }
+    bool run = strcmp(argv[2], "run") == 0;
+
+    std::ifstream in(argv[3]);
+    if (!in.is_open()) {
+        std::cerr << "Failed to open input file" << std::endl;
+        return -1;
+    }
+    std::stringstream source;
+    source << in.rdbuf();
+
+    int server = connect_to(argv[1]);
+    if (server < 0) {
+        std::cerr << "Failed to connect to " << argv[1] << ": " << strerror(errno) << std::endl;
+        return -1;
+    }
+
+    std::string request = std::string(argv[2]) + " " + std::to_string(source.str().size()) + "\n" + source.str();
+    if (!write_all(server, request.data(), request.size())) {
+        std::cerr << "Failed to send request" << std::endl;
+        return -1;
+    }
+    if (!run) {
+        shutdown(server, SHUT_WR);
+    }
+
+    // Forward our stdin to the program and its output to our stdout
+    // until the server hangs up. The first line of the response is
+    // a status line that we don't print.
+    bool stdin_open = run;
+    bool header_done = false;
+    std::string header;
+    char buffer[4096];
+    while (true) {
+        pollfd fds[2] = {
+            { server, POLLIN, 0 },
+            { STDIN_FILENO, POLLIN, 0 },
+        };
+        if (poll(fds, stdin_open ? 2 : 1, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -1;
+        }
+
+        if (stdin_open && fds[1].revents) {
+            ssize_t n = read(STDIN_FILENO, buffer, sizeof(buffer));
+            if (n <= 0 || !write_all(server, buffer, n)) {
+                stdin_open = false;
+                shutdown(server, SHUT_WR);
+            }
+        }
+
+        if (fds[0].revents) {
+            ssize_t n = read(server, buffer, sizeof(buffer));
+            if (n <= 0) {
+                break;
+            }
+
+            const char *output = buffer;
+            size_t size = n;
+            if (!header_done) {
+                const char *newline = (const char *)memchr(buffer, '\n', n);
+                header.append(buffer, newline ? newline - buffer : n);
+                if (!newline) {
+                    continue;
+                }
+                header_done = true;
+                if (header != "ok") {
+                    std::cerr << header << std::endl;
+                    return -1;
+                }
+                output = newline + 1;
+                size = n - (newline + 1 - buffer);
+            }
+            write_all(STDOUT_FILENO, output, size);
+        }
+    }
+
+    if (!header_done) {
+        std::cerr << "Server closed the connection" << std::endl;
+        return -1;
+    }
+    return 0;
+}
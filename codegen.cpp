@@ -1,387 +1,4491 @@
+#include <algorithm>
+#include <atomic>
 #include <fstream>
 #include <iostream>
+#include <iterator>
+#include <list>
+#include <sstream>
 #include <vector>
 #include <map>
+#include <set>
+#include <tuple>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <elf.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
 #include "llvm/ADT/APFloat.h"
 #include "llvm/ADT/STLExtras.h"
+#include "llvm/Bitcode/BitcodeReader.h"
+#include "llvm/Bitcode/BitcodeWriter.h"
+#include "llvm/CodeGen/ParallelCG.h"
+#include "llvm/Config/llvm-config.h"
+#include "llvm/ExecutionEngine/ObjectCache.h"
+#include "llvm/ExecutionEngine/Orc/CompileUtils.h"
+#include "llvm/ExecutionEngine/Orc/ExecutionUtils.h"
+#include "llvm/ExecutionEngine/Orc/LLJIT.h"
 #include "llvm/IR/BasicBlock.h"
 #include "llvm/IR/Constants.h"
 #include "llvm/IR/DerivedTypes.h"
 #include "llvm/IR/Function.h"
 #include "llvm/IR/IRBuilder.h"
+#include "llvm/IR/Intrinsics.h"
 #include "llvm/IR/LLVMContext.h"
+#include "llvm/IR/MDBuilder.h"
 #include "llvm/IR/Module.h"
+#include "llvm/IR/ProfileSummary.h"
 #include "llvm/IR/Type.h"
 #include "llvm/IR/LegacyPassManager.h"
+#include "llvm/IR/PassTimingInfo.h"
 #include "llvm/IR/Verifier.h"
+#include "llvm/Linker/Linker.h"
 #include "llvm/Support/TargetSelect.h"
+#include "llvm/Support/ThreadPool.h"
+#include "llvm/Support/TimeProfiler.h"
+#include "llvm/Support/Timer.h"
 #include "llvm/Target/TargetMachine.h"
 #include "llvm/Transforms/InstCombine/InstCombine.h"
 #include "llvm/Transforms/Scalar.h"
 #include "llvm/Transforms/Scalar/GVN.h"
+#include "llvm/Transforms/Utils/SplitModule.h"
 #include "llvm/MC/TargetRegistry.h"
+#include "llvm/ProfileData/ProfileCommon.h"
+#include "llvm/Support/CommandLine.h"
 #include "llvm/Support/FileSystem.h"
+#include "llvm/Support/Format.h"
+#include "llvm/Support/Host.h"
+#include "llvm/Support/JSON.h"
+#include "llvm/Support/MD5.h"
 #include "llvm/Support/TargetSelect.h"
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/Target/TargetMachine.h"
 #include "llvm/Target/TargetOptions.h"
+#include "bfllvm.h"
 
 using namespace llvm;
 using namespace std;
 
-const unsigned int TAPE_SIZE = 0x4000;
+const unsigned int TAPE_ALIGN = 16;
 
-static std::unique_ptr<LLVMContext> TheContext;
-static std::unique_ptr<Module> TheModule;
-static std::unique_ptr<IRBuilder<>> Builder;
-static std::map<std::string, AllocaInst *> NamedValues;
-static std::unique_ptr<legacy::FunctionPassManager> TheFPM;
+// Tapes of up to this many cells live on the stack, bigger ones are mapped
+const uint64_t MAX_STACK_TAPE = 0x10000;
 
-static void llvm_init() {
-    // Open a new module.
-    TheContext = std::make_unique<LLVMContext>();
-    TheModule = std::make_unique<Module>("brainfuck", *TheContext);
+// Cells mapped on either side of a mapped tape, so that code can touch
+// cells close to the ones it accesses without testing first whether
+// they are on the tape
+const uint64_t TAPE_MARGIN = 0x1000;
 
-    // Create a new builder for the module.
-    Builder = std::make_unique<IRBuilder<>>(*TheContext);
+static cl::opt<std::string> InputFilename(
+    cl::Positional,
+    cl::desc("<input file>"),
+    cl::init("program.bf")
+);
 
-    // Create a new pass manager attached to it.
-    TheFPM = std::make_unique<legacy::FunctionPassManager>(TheModule.get());
+static cl::opt<bool> RunProgram(
+    "run",
+    cl::desc("JIT-compile and execute the program instead of printing its IR")
+);
 
-    // Do simple "peephole" optimizations and bit-twiddling optzns.
-    TheFPM->add(createInstructionCombiningPass());
-    // Reassociate expressions.
-    TheFPM->add(createReassociatePass());
-    // Eliminate Common SubExpressions.
-    TheFPM->add(createGVNPass());
-    // Simplify the control flow graph (deleting unreachable blocks, etc).
-    TheFPM->add(createCFGSimplificationPass());
+enum BackendKind {
+    LLVM_BACKEND,
+    X86_BACKEND,
+    STENCIL_BACKEND,
+};
+
+static cl::opt<BackendKind> Backend(
+    "backend",
+    cl::desc("How to generate machine code"),
+    cl::values(
+        clEnumValN(LLVM_BACKEND, "llvm", "Optimize with LLVM"),
+        clEnumValN(X86_BACKEND, "x86", "Emit x86-64 directly from the parsed program, for fast compiles"),
+        clEnumValN(STENCIL_BACKEND, "stencil", "Copy and patch precompiled x86-64 stencils for each AST node")
+    ),
+    cl::init(LLVM_BACKEND)
+);
+
+static cl::opt<std::string> OutputFilename(
+    "o",
+    cl::desc("Where the x86 and stencil backends write the executable when not running the program"),
+    cl::value_desc("filename"),
+    cl::init("a.out")
+);
+
+static cl::opt<bool> RunBenchmark(
+    "bench",
+    cl::desc("Print a JSON report of the time spent in each compiler phase and in running the program")
+);
+
+static cl::opt<unsigned> BenchmarkRuns(
+    "bench-runs",
+    cl::desc("Number of times --bench executes the program"),
+    cl::init(1)
+);
+
+static cl::opt<unsigned> BenchmarkTimeout(
+    "bench-timeout",
+    cl::desc("Seconds after which --bench gives up on running the program"),
+    cl::init(60)
+);
+
+static cl::opt<bool> TimeReportFlag(
+    "time-report",
+    cl::desc("Print the time and memory spent in each compiler phase and LLVM pass to stderr, "
+             "and write them as a Chrome trace")
+);
+
+static cl::opt<std::string> TimeTraceFile(
+    "time-trace-file",
+    cl::desc("Where --time-report writes its Chrome trace event JSON"),
+    cl::value_desc("filename"),
+    cl::init("codegen.time-trace.json")
+);
+
+static cl::opt<bool> Profile(
+    "profile",
+    cl::desc("Instrument every loop with execution counters that are written to a profile on exit")
+);
+
+static cl::opt<bool> ProfileCycles(
+    "profile-cycles",
+    cl::desc("Also accumulate the cycles spent in every loop (implies --profile)")
+);
+
+static cl::opt<std::string> ProfileOutput(
+    "profile-output",
+    cl::desc("Where instrumented programs write their loop profile"),
+    cl::value_desc("filename"),
+    cl::init("bf.profile")
+);
+
+static cl::opt<std::string> ProfileUse(
+    "profile-use",
+    cl::desc("Optimize using a loop profile written by a --profile build"),
+    cl::value_desc("filename")
+);
+
+static cl::opt<bool> PromoteCells(
+    "promote-cells",
+    cl::desc("Keep the cells used by balanced loop nests in registers"),
+    cl::init(true)
+);
+
+static cl::opt<bool> RunAstPasses(
+    "ast-passes",
+    cl::desc("Rewrite common loop idioms in the AST before emitting IR"),
+    cl::init(true)
+);
+
+static cl::opt<bool> BoundsChecks(
+    "bounds-check",
+    cl::desc("Exit with an error instead of accessing cells off the tape")
+);
+
+static cl::opt<uint64_t> TapeSize(
+    "tape-size",
+    cl::desc("Number of cells to map for programs whose tape footprint can't be bounded"),
+    cl::init(0x10000000)
+);
+
+static cl::opt<unsigned> OutlineThreshold(
+    "outline-threshold",
+    cl::desc("Split scopes of more AST nodes than this into functions of their own (0 to never split)"),
+    cl::init(4000)
+);
+
+static cl::opt<unsigned> Jobs(
+    "jobs",
+    cl::desc("Optimize and generate code for the functions of a split program on this many threads"),
+    cl::init(1)
+);
+
+static cl::opt<bool> StreamProgram(
+    "stream",
+    cl::desc("With --run, compile and run the program a chunk at a time to bound the compiler's memory use")
+);
+
+static cl::opt<unsigned> StreamChunk(
+    "stream-chunk",
+    cl::desc("Number of AST nodes --stream compiles at a time, rounded up to whole top-level loops"),
+    cl::init(2000)
+);
+
+static cl::opt<bool> ForkServerLoop(
+    "fork-server",
+    cl::desc("Make main() an AFL-style fork server that runs the program in a fresh child on every request")
+);
 
-    TheFPM->doInitialization();
+static cl::opt<bool> FilterRecords(
+    "filter",
+    cl::desc("Run the program once for every record of the standard input, with a fresh tape each time")
+);
 
+static cl::opt<std::string> RecordDelimiter(
+    "record-delimiter",
+    cl::desc("Character that ends the records of --filter, or one of \\n, \\t and \\0"),
+    cl::init("\\n")
+);
+
+static cl::opt<unsigned> FilterWorkers(
+    "filter-workers",
+    cl::desc("Number of threads --filter runs records on, 0 for one per core"),
+    cl::init(0)
+);
+
+static cl::opt<bool> EntryPoint(
+    "entry",
+    cl::desc("Emit a reentrant bf_run(tape, position, io) function (see bfllvm.h) instead of main()")
+);
+
+static cl::opt<std::string> CacheDir(
+    "cache-dir",
+    cl::desc("Keep the object code of programs run with --run in this directory and reuse it on later runs"),
+    cl::value_desc("directory")
+);
+
+static cl::opt<std::string> ServeSocket(
+    "serve",
+    cl::desc("Run as a compile server listening on the given unix socket"),
+    cl::value_desc("socket path")
+);
+
+static cl::opt<unsigned> ServeWorkers(
+    "serve-workers",
+    cl::desc("Number of compiler worker threads used by --serve"),
+    cl::init(4)
+);
+
+static cl::opt<unsigned> ServeCacheSize(
+    "serve-cache-size",
+    cl::desc("Number of compiled programs --serve keeps, least recently used ones are dropped first"),
+    cl::init(256)
+);
+
+static cl::opt<unsigned> ServeTimeout(
+    "serve-timeout",
+    cl::desc("Seconds a program run by --serve may take before it is killed (0 for no limit)"),
+    cl::init(60)
+);
+
+// Every worker thread of the compile server owns its own set of
+// LLVM data structures, so the globals are thread local.
+static thread_local std::unique_ptr<LLVMContext> TheContext;
+static thread_local std::unique_ptr<Module> TheModule;
+static thread_local std::unique_ptr<IRBuilder<>> Builder;
+static thread_local std::map<std::string, Value *> NamedValues;
+// SSA value of the write head position at the builder's insertion point
+static thread_local Value *CurrentPosition;
+static thread_local std::unique_ptr<legacy::FunctionPassManager> TheFPM;
+
+static void llvm_init_targets() {
     InitializeNativeTarget();
     InitializeNativeTargetAsmPrinter();
     InitializeNativeTargetAsmParser();
 }
 
-static Value* get_current_position() {
-    AllocaInst *position_var = NamedValues["position"];
-    return Builder->CreateLoad(
-        position_var->getAllocatedType(), 
-        position_var, 
-        "position"
-    );
+static std::unique_ptr<legacy::FunctionPassManager> create_function_pass_manager(Module *module) {
+    auto fpm = std::make_unique<legacy::FunctionPassManager>(module);
+
+    // Do simple "peephole" optimizations and bit-twiddling optzns.
+    fpm->add(createInstructionCombiningPass());
+    // Reassociate expressions.
+    fpm->add(createReassociatePass());
+    // Eliminate Common SubExpressions.
+    fpm->add(createGVNPass());
+    // Simplify the control flow graph (deleting unreachable blocks, etc).
+    fpm->add(createCFGSimplificationPass());
+
+    fpm->doInitialization();
+    return fpm;
 }
 
-static Value* get_current_tape_cell_ptr() {
-    AllocaInst *tape = NamedValues["tape"];
+static void llvm_init() {
+    // Open a new module.
+    TheContext = std::make_unique<LLVMContext>();
+    TheModule = std::make_unique<Module>("brainfuck", *TheContext);
 
-    // Get the address of the cell value at the current positin
-    return Builder->CreateGEP(
-        tape->getAllocatedType(), 
-        tape, 
-        {
-            ConstantInt::get(Type::getInt8Ty(*TheContext), 0), 
-            get_current_position()
-        },
-        "tape cell ptr"
-    );
+    // Create a new builder for the module.
+    Builder = std::make_unique<IRBuilder<>>(*TheContext);
+
+    // Create a new pass manager attached to it.
+    TheFPM = create_function_pass_manager(TheModule.get());
 }
 
-static Value* get_current_tape_value() {
-    Value* ptr = get_current_tape_cell_ptr();
-    return Builder->CreateLoad(
-        Type::getInt8Ty(*TheContext), 
-        ptr
-    );
+namespace TimeReport {
+
+// Only ever enabled for a single compilation on the main thread
+static bool Enabled = false;
+
+struct Phase {
+    std::string name;
+    TimeRecord time;
+    long peak_rss_kib;
+};
+
+static std::vector<Phase> Phases;
+static std::vector<std::pair<std::string, size_t>> NodeCounts;
+
+static long peak_rss_kib() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
 }
 
-namespace Ast {
+// Measures the compiler phase that runs during its lifetime.
+// The phase also shows up in the Chrome trace.
+class Scope {
+    std::string name;
+    TimeRecord start;
+    TimeTraceScope trace;
 
-class Node {
 public:
-    static Node* try_parse(std::fstream&);
-
-    virtual void debug_print()=0;
-    virtual void codegen()=0;
+    explicit Scope(StringRef name): name(name.str()), trace(name) {
+        if (Enabled) {
+            start = TimeRecord::getCurrentTime(true);
+        }
+    }
 
+    ~Scope() {
+        if (!Enabled) {
+            return;
+        }
+        TimeRecord time = TimeRecord::getCurrentTime(false);
+        time -= start;
+        Phases.push_back({ name, time, peak_rss_kib() });
+    }
 };
 
-// +
-class IncrementNode: public Node {
-    void debug_print() override {
-        std::cout << "+";
+// Record the size of the AST at some point in the pipeline
+static void node_count(StringRef stage, size_t nodes) {
+    if (Enabled) {
+        NodeCounts.push_back({ stage.str(), nodes });
     }
+}
 
-    void codegen() override {
-        // Load the current value in the cell
-        Value* tape_cell_ptr = get_current_tape_cell_ptr();
-        Value* tape_cell = Builder->CreateLoad(
-            Type::getInt8Ty(*TheContext),
-            tape_cell_ptr,
-            "tape cell"
-        );
-
-        // Increment the value
-        Value *to_add = ConstantInt::get(Type::getInt8Ty(*TheContext), 1);
-        Value *new_value = Builder->CreateAdd(tape_cell, to_add, "new tape value");
+#ifndef BFLLVM_LIBRARY
+static void enable() {
+    Enabled = true;
+    TimePassesIsEnabled = true;
+    timeTraceProfilerInitialize(0, "codegen");
+}
 
-        // Write back
-        Builder->CreateStore(new_value, tape_cell_ptr);
-    };
-};
+static void print(raw_ostream &out) {
+    out << "===" << std::string(73, '-') << "===\n";
+    out << "                        Brainfuck compiler time report\n";
+    out << "===" << std::string(73, '-') << "===\n";
+    out << "  Phase          Wall (ms)   User (ms)    Sys (ms)  Peak RSS (KiB)\n";
 
-// -
-class DecrementNode: public Node {
-    void debug_print() override {
-        std::cout << "-";
+    TimeRecord total;
+    for (auto &phase: Phases) {
+        out << format("  %-12s %11.3f %11.3f %11.3f %15ld\n",
+            phase.name.c_str(),
+            phase.time.getWallTime() * 1000,
+            phase.time.getUserTime() * 1000,
+            phase.time.getSystemTime() * 1000,
+            phase.peak_rss_kib);
+        total += phase.time;
     }
+    out << format("  Total        %11.3f %11.3f %11.3f %15ld\n\n",
+        total.getWallTime() * 1000,
+        total.getUserTime() * 1000,
+        total.getSystemTime() * 1000,
+        peak_rss_kib());
 
-    void codegen() override {
-        // Load the current value in the cell
-        Value* tape_cell_ptr = get_current_tape_cell_ptr();
-        Value* tape_cell = Builder->CreateLoad(
-            Type::getInt8Ty(*TheContext),
-            tape_cell_ptr,
-            "tape cell"
-        );
+    out << "  AST                           Nodes\n";
+    for (auto &count: NodeCounts) {
+        out << format("  %-24s %10zu\n", count.first.c_str(), count.second);
+    }
+    out << "\n";
+}
 
-        // Decrement the value
-        Value *to_sub = ConstantInt::get(Type::getInt8Ty(*TheContext), 1);
-        Value *new_value = Builder->CreateSub(tape_cell, to_sub, "new tape value");
+// Print the report, including LLVM's pass timings, and write the trace
+static void finish() {
+    if (!Enabled) {
+        return;
+    }
 
-        // Write back
-        Builder->CreateStore(new_value, tape_cell_ptr);
-    };
-};
+    print(errs());
+    reportAndResetTimings(&errs());
 
-// <
-class MoveLeftNode: public Node {
-    void debug_print() override {
-        std::cout << "<";
+    if (Error err = timeTraceProfilerWrite(TimeTraceFile, "codegen")) {
+        errs() << "Failed to write time trace: " << toString(std::move(err)) << "\n";
     }
+    timeTraceProfilerCleanup();
+}
+#endif
+}
 
-    void codegen() override {
-        AllocaInst *var = NamedValues["position"];
+static Value* get_current_position() {
+    return CurrentPosition;
+}
 
-        Value *to_sub = ConstantInt::get(Type::getInt64Ty(*TheContext), 1);
-        Value *current_value = Builder->CreateLoad(var->getAllocatedType(), var, "position");
-        Value *new_value = Builder->CreateSub(current_value, to_sub, "next position");
+static Value* get_tape_cell_ptr(Value *position) {
+    // "tape" points at the cell the program starts at
+    Value *tape = NamedValues["tape"];
 
-        Builder->CreateStore(new_value, var);
-    };
-};
+    // Get the address of the cell value at the given position
+    return Builder->CreateGEP(
+        Type::getInt8Ty(*TheContext),
+        tape,
+        position,
+        "tape cell ptr"
+    );
+}
 
-// > 
-class MoveRightNode: public Node {
-    void debug_print() override {
-        std::cout << ">";
-    }
+namespace TapeMetadata {
+static thread_local MDNode *TBAATag = nullptr;
+static thread_local MDNode *Scope = nullptr;
 
-    void codegen() override {
-        AllocaInst *var = NamedValues["position"];
+// Give the tape its own TBAA type and alias scope, so that LLVM knows
+// that tape accesses don't alias anything else in the module
+static void create() {
+    MDBuilder mdb(*TheContext);
+    MDNode *root = mdb.createTBAARoot("brainfuck tbaa");
+    MDNode *cell = mdb.createTBAAScalarTypeNode("tape cell", root);
+    TBAATag = mdb.createTBAAStructTagNode(cell, cell, 0);
 
-        Value *to_add = ConstantInt::get(Type::getInt64Ty(*TheContext), 1);
-        Value *current_value = Builder->CreateLoad(var->getAllocatedType(), var, "position");
-        Value *new_value = Builder->CreateAdd(current_value, to_add, "next position");
+    MDNode *domain = mdb.createAnonymousAliasScopeDomain("brainfuck");
+    MDNode *tape = mdb.createAnonymousAliasScope(domain, "tape");
+    Scope = MDNode::get(*TheContext, { tape });
+}
 
-        Builder->CreateStore(new_value, var);
-    };
-};
+template <typename T>
+static T* annotate_access(T *access) {
+    access->setMetadata(LLVMContext::MD_tbaa, TBAATag);
+    access->setMetadata(LLVMContext::MD_alias_scope, Scope);
+    return access;
+}
 
-// .
-class PutCharNode: public Node {
-    void debug_print() override {
-        std::cout << ".";
-    }
+// Calls that may access memory, but never the tape
+static CallInst* annotate_call(CallInst *call) {
+    call->setMetadata(LLVMContext::MD_noalias, Scope);
+    return call;
+}
+}
 
-    void codegen() override {
-        // declare putchar() function
-        FunctionType* putchar_type = FunctionType::get(
-            Type::getInt32Ty(*TheContext),  // returns int
-            { Type::getInt8Ty(*TheContext) },  // single character argument
-            false
-        );
-        FunctionCallee putchar = TheModule->getOrInsertFunction("putchar", putchar_type);
+// putchar() and getchar() only touch libc's own buffers
+static FunctionCallee get_io_function(StringRef name, FunctionType *type) {
+    FunctionCallee callee = TheModule->getOrInsertFunction(name, type);
+    if (Function *function = dyn_cast<Function>(callee.getCallee())) {
+        function->addFnAttr(Attribute::InaccessibleMemOnly);
+        function->addFnAttr(Attribute::NoUnwind);
+        function->addFnAttr(Attribute::WillReturn);
+    }
+    return callee;
+}
 
-        // Read the cell value at the current position
-        Value *tape_cell = get_current_tape_value();
+// With --entry, programs talk to the bf_io channel passed to bf_run()
+// instead of calling putchar() and getchar()
+namespace IOChannel {
+static thread_local bool Active = false;
 
-        // Call putchar
-        Builder->CreateCall(
-            putchar_type, 
-            putchar.getCallee(), 
-            { tape_cell }, 
-            "putchar()"
-        );
-    };
+enum Field {
+    CONTEXT,
+    PUT,
+    GET,
 };
 
-// ,
-class GetCharNode: public Node {
-    void debug_print() override {
-        std::cout << ",";
+// struct bf_io in bfllvm.h
+static StructType* get_type() {
+    StructType *type = StructType::getTypeByName(*TheContext, "bf_io");
+    if (type) {
+        return type;
     }
+    Type *context_type = Type::getInt8PtrTy(*TheContext);
+    Type *int_type = Type::getInt32Ty(*TheContext);
+    return StructType::create(*TheContext, {
+        context_type,
+        FunctionType::get(int_type, { context_type, int_type }, false)->getPointerTo(),
+        FunctionType::get(int_type, { context_type }, false)->getPointerTo(),
+    }, "bf_io");
+}
 
-    void codegen() override {
-        // declare getchar() function
-        FunctionType* getchar_type = FunctionType::get(
-            Type::getInt32Ty(*TheContext),
-            {},
-            false
-        );
-        FunctionCallee getchar = TheModule->getOrInsertFunction("getchar", getchar_type);
+// Call one of the functions of the channel with its context
+static CallInst* call(Field field, ArrayRef<Value *> arguments, const std::string &name) {
+    StructType *type = get_type();
+    Value *io = NamedValues["io"];
+    Value *context = Builder->CreateLoad(
+        type->getElementType(CONTEXT),
+        Builder->CreateStructGEP(type, io, CONTEXT),
+        "io context"
+    );
+    Type *function_type = type->getElementType(field)->getPointerElementType();
+    Value *function = Builder->CreateLoad(
+        type->getElementType(field),
+        Builder->CreateStructGEP(type, io, field),
+        name + " function"
+    );
+    std::vector<Value *> all_arguments = { context };
+    all_arguments.insert(all_arguments.end(), arguments.begin(), arguments.end());
+    return Builder->CreateCall(cast<FunctionType>(function_type), function, all_arguments, name);
+}
+}
 
-        // Call getchar
-        Value *c = Builder->CreateCall(
-            getchar_type, 
-            getchar.getCallee(), 
-            {}, 
-            "getchar()"
-        );
+static Value* get_current_tape_cell_ptr() {
+    return get_tape_cell_ptr(get_current_position());
+}
 
-        // Truncate the value to an i8, so we can store it in the tape cell
-        Value *truncated_char = Builder->CreateIntCast(c, Type::getInt8Ty(*TheContext), true);
+// Get the address of the cell `delta` cells away from the current position
+static Value* get_relative_cell_ptr(int64_t delta) {
+    if (delta == 0) {
+        return get_current_tape_cell_ptr();
+    }
+    Value *position = Builder->CreateAdd(
+        get_current_position(),
+        ConstantInt::get(Type::getInt64Ty(*TheContext), delta),
+        "cell position"
+    );
+    return get_tape_cell_ptr(position);
+}
 
-        // Read the cell value at the current position
-        AllocaInst *tape = NamedValues["tape"];
-        Value *tape_cell_ptr = get_current_tape_cell_ptr();
-        Builder->CreateStore(truncated_char, tape_cell_ptr);
-    };
-};
+namespace CellPromotion {
 
-class ScopeNode: public Node {
-protected:
-    std::vector<Node *> children;
+// Loop nests touching more cells than this stay in memory
+const size_t MAX_CELLS = 64;
 
-public:
-    explicit ScopeNode(std::vector<Node *> children): children(children) {};
+// Inside a promoted loop nest, the cells at fixed offsets from the
+// position the nest was entered with live in registers
+static thread_local bool Active = false;
 
-};
+// Current position relative to the one the loop nest was entered with
+static thread_local int64_t Offset = 0;
 
-class ProgramNode: public ScopeNode {
-public:
-    using ScopeNode::ScopeNode;
+static thread_local std::map<int64_t, Value *> Cells;
 
-    static Ast::Node* try_parse(std::fstream&);
+// Cells that have to be written back when leaving the loop nest
+static thread_local std::set<int64_t> Written;
 
-    void debug_print() override {
-        for (auto child: children) {
-            child->debug_print();
+static Value* get_cell_ptr(int64_t offset) {
+    return get_relative_cell_ptr(offset - Offset);
+}
+
+// Load the cells a loop nest accesses (with whether it writes them)
+static void begin(const std::map<int64_t, bool> &accessed) {
+    Offset = 0;
+    for (auto &cell: accessed) {
+        Cells[cell.first] = TapeMetadata::annotate_access(Builder->CreateLoad(
+            Type::getInt8Ty(*TheContext),
+            get_cell_ptr(cell.first),
+            "promoted cell"
+        ));
+        if (cell.second) {
+            Written.insert(cell.first);
         }
     }
+    Active = true;
+}
 
-    void codegen() override {
-        // Setup main function
-        FunctionType *main_type = FunctionType::get(Builder->getVoidTy(), false);
-        Function* main = Function::Create(
-            main_type, 
-            GlobalValue::ExternalLinkage, 
-            "main", 
-            *TheModule
-        );
+// Store the modified cells back to the tape
+static void end() {
+    for (int64_t offset: Written) {
+        TapeMetadata::annotate_access(Builder->CreateStore(Cells[offset], get_cell_ptr(offset)));
+    }
+    Active = false;
+    Cells.clear();
+    Written.clear();
+}
+}
 
-        // Point the builder to the start of the main function
-        BasicBlock *main_block = BasicBlock::Create(*TheContext, "entry", main);
-        Builder->SetInsertPoint(main_block);
+// Cells at a known distance from the current position
+static Value* load_cell(int64_t delta) {
+    if (CellPromotion::Active) {
+        return CellPromotion::Cells.at(CellPromotion::Offset + delta);
+    }
+    return TapeMetadata::annotate_access(Builder->CreateLoad(
+        Type::getInt8Ty(*TheContext),
+        get_relative_cell_ptr(delta)
+    ));
+}
 
-        // Allocate the position of the write head
-        AllocaInst* position = Builder->CreateAlloca(
-            Type::getInt64Ty(*TheContext),
-            nullptr,
-            "position"
-        );
+static void store_cell(int64_t delta, Value *value) {
+    if (CellPromotion::Active) {
+        CellPromotion::Cells.at(CellPromotion::Offset + delta) = value;
+        return;
+    }
+    TapeMetadata::annotate_access(Builder->CreateStore(value, get_relative_cell_ptr(delta)));
+}
 
-        Value* initial_value = ConstantInt::get(Type::getInt64Ty(*TheContext), 0);
-        Builder->CreateStore(initial_value, position);
-        NamedValues["position"] = position;
+static Value* load_current_cell() {
+    return load_cell(0);
+}
 
-        // Allocate the tape storage
-        Type* tape_type = ArrayType::get(Type::getInt8Ty(*TheContext), TAPE_SIZE);
-        AllocaInst* tape = Builder->CreateAlloca(
-            tape_type,
-            nullptr,
-            "tape"
-        );
+static void store_current_cell(Value *value) {
+    store_cell(0, value);
+}
 
-        Constant* initial_tape = ConstantAggregateZero::get(tape_type); 
-        Builder->CreateStore(initial_tape, tape);
-        NamedValues["tape"] = tape;
+static void move_position(int64_t delta) {
+    Value *to_add = ConstantInt::get(Type::getInt64Ty(*TheContext), delta);
+    CurrentPosition = Builder->CreateAdd(get_current_position(), to_add, "next position");
+    CellPromotion::Offset += delta;
+}
 
-        // Emit IR for each child
-        for (auto child: children) {
-            child->codegen();
-        }
+// The values that loops carry around in registers:
+// the position and any promoted cells
+struct RegisterState {
+    Value *position;
+    std::map<int64_t, Value *> cells;
 
-        Builder->CreateRet(NULL);
-        verifyFunction(*main);
+    static RegisterState current() {
+        return { CurrentPosition, CellPromotion::Cells };
     }
-};
 
-// [ ... ]
-class ConditionalGroupNode: public ScopeNode {
-public:
-    using ScopeNode::ScopeNode;
+    void restore() const {
+        CurrentPosition = position;
+        CellPromotion::Cells = cells;
+    }
 
-    static Ast::Node* try_parse(std::fstream&);
+    // Create a phi node for every value in `state` at the insertion point
+    static RegisterState create_phis(const RegisterState &state) {
+        RegisterState phis;
+        phis.position = Builder->CreatePHI(Type::getInt64Ty(*TheContext), 2, "position");
+        for (auto &cell: state.cells) {
+            phis.cells[cell.first] = Builder->CreatePHI(Type::getInt8Ty(*TheContext), 2, "cell");
+        }
+        return phis;
+    }
 
-    void debug_print() override {
-        std::cout << '[';
-        for (auto child: children) {
-            child->debug_print();
+    void add_incoming(const RegisterState &values, BasicBlock *block) {
+        cast<PHINode>(position)->addIncoming(values.position, block);
+        for (auto &cell: cells) {
+            cast<PHINode>(cell.second)->addIncoming(values.cells.at(cell.first), block);
         }
-        std::cout << ']';
     }
+};
 
-    void codegen() override {
-        AllocaInst *position_var = NamedValues["position"];
-        AllocaInst *tape = NamedValues["tape"];
+// Emit what `then` emits only if `condition` holds, for cells
+// that may not be on the tape unless it does
+template <typename Emit>
+static void emit_if(Value *condition, const std::string &name, Emit then) {
+    Function *function = Builder->GetInsertBlock()->getParent();
+    BasicBlock *then_block = BasicBlock::Create(*TheContext, name, function);
+    BasicBlock *merge = BasicBlock::Create(*TheContext, name + " end", function);
 
-        BasicBlock *base_block = Builder->GetInsertBlock();
-        Function *TheFunction = base_block->getParent();
+    BasicBlock *entry_block = Builder->GetInsertBlock();
+    RegisterState entry_state = RegisterState::current();
+    Builder->CreateCondBr(condition, then_block, merge);
 
-        // Entry Condition:
-        // Check if the current tape cell is zero, if so,
-        // jump past the end of the group
-        Value* start_condition = Builder->CreateICmpNE(
-            get_current_tape_value(), 
-            ConstantInt::get(Type::getInt8Ty(*TheContext), 0)
-        );
+    Builder->SetInsertPoint(then_block);
+    then();
+    RegisterState then_state = RegisterState::current();
+    BasicBlock *then_end = Builder->GetInsertBlock();
+    Builder->CreateBr(merge);
 
-        BasicBlock *group_content = BasicBlock::Create(*TheContext, "group content", TheFunction);
-        BasicBlock *merge = BasicBlock::Create(*TheContext, "merge", TheFunction);
+    Builder->SetInsertPoint(merge);
+    RegisterState merge_state = RegisterState::create_phis(entry_state);
+    merge_state.add_incoming(entry_state, entry_block);
+    merge_state.add_incoming(then_state, then_end);
+    merge_state.restore();
+}
 
-        Builder->CreateCondBr(start_condition, group_content, merge);
+namespace LoopProfile {
 
-        // If the value is not zero, we simply emit all the child IR
-        Builder->SetInsertPoint(group_content);
+// Every instrumented loop owns one of these counter arrays
+enum Counter {
+    REACHED,     // times the loop condition was checked on entry
+    ENTERED,     // times the loop body was entered from outside
+    ITERATIONS,  // times the loop body was executed
+    CYCLES,      // cycles spent inside the loop, with --profile-cycles
+    NUM_COUNTERS
+};
 
-        for (auto child: children) {
-            child->codegen();
-        }
+// Source offset of each loop's '[' and its counters, in emission order
+static thread_local std::vector<std::pair<size_t, GlobalVariable *>> Loops;
 
-        // At the end of the is not zero block, chekc if the current
-        // cell is zero, in which case jump back to the start of the group
-        Value* end_condition = Builder->CreateICmpNE(
-            get_current_tape_value(), 
-            ConstantInt::get(Type::getInt8Ty(*TheContext), 0)
-        );
+static bool enabled() {
+    return Profile || ProfileCycles;
+}
 
-        // Explicitly fallthrough out of the if branch
-        Builder->CreateCondBr(end_condition, group_content, merge);
+static GlobalVariable* create_counters(size_t source_offset) {
+    Type *counters_type = ArrayType::get(Type::getInt64Ty(*TheContext), NUM_COUNTERS);
+    GlobalVariable *counters = new GlobalVariable(
+        *TheModule,
+        counters_type,
+        false,
+        GlobalValue::InternalLinkage,
+        ConstantAggregateZero::get(counters_type),
+        "loop profile " + std::to_string(source_offset)
+    );
+    Loops.push_back({ source_offset, counters });
+    return counters;
+}
 
-        // The merge block simply falls through back into the base block
-        Builder->SetInsertPoint(merge);
-    }
-};
+static Value* get_counter_ptr(GlobalVariable *counters, Counter counter) {
+    return Builder->CreateConstInBoundsGEP2_64(counters->getValueType(), counters, 0, counter);
 }
 
-Ast::Node* Ast::Node::try_parse(fstream &in) {
-    while(true) {
-        char c;
-        if (!(in >> c)) {
-            return NULL;
-        }
+static void add_to_counter(GlobalVariable *counters, Counter counter, Value *amount) {
+    Value *counter_ptr = get_counter_ptr(counters, counter);
+    Value *value = Builder->CreateLoad(Type::getInt64Ty(*TheContext), counter_ptr, "counter");
+    Builder->CreateStore(Builder->CreateAdd(value, amount, "new counter"), counter_ptr);
+}
+
+static void increment_counter(GlobalVariable *counters, Counter counter) {
+    add_to_counter(counters, counter, ConstantInt::get(Type::getInt64Ty(*TheContext), 1));
+}
+
+static Value* read_cycle_counter() {
+    Function *readcyclecounter = Intrinsic::getDeclaration(TheModule.get(), Intrinsic::readcyclecounter);
+    return Builder->CreateCall(readcyclecounter, {}, "cycles");
+}
+
+// Emit code that writes all counters to the profile file, one loop per line:
+//     <source offset> <reached> <entered> <iterations> <cycles>
+static void emit_dump() {
+    Type *i8_ptr = Type::getInt8PtrTy(*TheContext);
+    Type *i32 = Type::getInt32Ty(*TheContext);
+    FunctionCallee fopen = TheModule->getOrInsertFunction("fopen", i8_ptr, i8_ptr, i8_ptr);
+    FunctionCallee fprintf = TheModule->getOrInsertFunction(
+        "fprintf",
+        FunctionType::get(i32, { i8_ptr, i8_ptr }, true)
+    );
+    FunctionCallee fclose = TheModule->getOrInsertFunction("fclose", i32, i8_ptr);
+
+    BasicBlock *dump_block = BasicBlock::Create(*TheContext, "dump profile", Builder->GetInsertBlock()->getParent());
+    BasicBlock *done_block = BasicBlock::Create(*TheContext, "profile done", Builder->GetInsertBlock()->getParent());
+
+    Value *file = Builder->CreateCall(fopen, {
+        Builder->CreateGlobalStringPtr(ProfileOutput.getValue()),
+        Builder->CreateGlobalStringPtr("w")
+    }, "profile file");
+    Builder->CreateCondBr(Builder->CreateIsNull(file), done_block, dump_block);
+
+    Builder->SetInsertPoint(dump_block);
+    Builder->CreateCall(fprintf, {
+        file,
+        Builder->CreateGlobalStringPtr("# offset reached entered iterations cycles\n")
+    });
+    Value *line_format = Builder->CreateGlobalStringPtr("%llu %llu %llu %llu %llu\n");
+    for (auto &loop: Loops) {
+        std::vector<Value *> arguments = {
+            file,
+            line_format,
+            ConstantInt::get(Type::getInt64Ty(*TheContext), loop.first)
+        };
+        for (unsigned counter = REACHED; counter < NUM_COUNTERS; counter++) {
+            arguments.push_back(Builder->CreateLoad(
+                Type::getInt64Ty(*TheContext),
+                get_counter_ptr(loop.second, (Counter)counter)
+            ));
+        }
+        Builder->CreateCall(fprintf, arguments);
+    }
+    Builder->CreateCall(fclose, { file });
+    Builder->CreateBr(done_block);
+
+    Builder->SetInsertPoint(done_block);
+}
+
+struct Counts {
+    uint64_t reached;
+    uint64_t entered;
+    uint64_t iterations;
+    uint64_t cycles;
+};
+
+// The profile given with --profile-use, keyed by source offset
+static std::map<size_t, Counts> Recorded;
+
+// Loops with at least this many iterations make up 99% of all
+// iterations and are considered hot
+static uint64_t HotIterations = 0;
+
+// Number of recorded loops that were found in the program
+static thread_local size_t Matched = 0;
+
+#ifndef BFLLVM_LIBRARY
+static bool load(const std::string &path, std::string &error) {
+    std::ifstream in(path);
+    if (!in.is_open()) {
+        error = "Failed to open profile " + path;
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        std::istringstream fields(line);
+        size_t source_offset;
+        Counts counts;
+        if (!(fields >> source_offset >> counts.reached >> counts.entered >> counts.iterations >> counts.cycles)) {
+            error = "Malformed profile line: " + line;
+            return false;
+        }
+        Recorded[source_offset] = counts;
+    }
+
+    std::vector<uint64_t> iterations;
+    uint64_t total = 0;
+    for (auto &loop: Recorded) {
+        iterations.push_back(loop.second.iterations);
+        total += loop.second.iterations;
+    }
+    std::sort(iterations.rbegin(), iterations.rend());
+
+    uint64_t covered = 0;
+    for (uint64_t count: iterations) {
+        HotIterations = count;
+        covered += count;
+        if (covered >= total / 100 * 99) {
+            break;
+        }
+    }
+    return true;
+}
+#endif
+
+static const Counts* lookup(size_t source_offset) {
+    auto loop = Recorded.find(source_offset);
+    if (loop == Recorded.end()) {
+        return nullptr;
+    }
+    Matched++;
+    return &loop->second;
+}
+
+// Attach a profile summary to the module, so that LLVM's
+// ProfileSummaryInfo can tell hot code from cold code
+static void set_profile_summary() {
+    std::vector<uint64_t> counts = { 1 };
+    for (auto &loop: Recorded) {
+        counts.push_back(loop.second.reached);
+        counts.push_back(loop.second.iterations);
+    }
+    std::sort(counts.rbegin(), counts.rend());
+
+    uint64_t total = 0;
+    for (uint64_t count: counts) {
+        total += count;
+    }
+
+    SummaryEntryVector detailed;
+    for (uint32_t cutoff: ProfileSummaryBuilder::DefaultCutoffs) {
+        uint64_t desired = (uint64_t)((double)total * cutoff / ProfileSummary::Scale);
+        uint64_t covered = 0;
+        uint64_t taken = 0;
+        while (taken < counts.size() && (covered < desired || taken == 0)) {
+            covered += counts[taken++];
+        }
+        detailed.push_back({ cutoff, counts[taken - 1], taken });
+    }
+
+    ProfileSummary summary(
+        ProfileSummary::PSK_Instr,
+        detailed,
+        total,
+        counts.front(),
+        counts.front(),
+        1,
+        counts.size(),
+        1
+    );
+    TheModule->setProfileSummary(summary.getMD(*TheContext), ProfileSummary::PSK_Instr);
+}
+
+// Branch weights are 32 bit, so scale the counts down if necessary
+static MDNode* branch_weights(uint64_t taken, uint64_t not_taken) {
+    uint64_t scale = std::max(taken, not_taken) / UINT32_MAX + 1;
+    return MDBuilder(*TheContext).createBranchWeights(taken / scale, not_taken / scale);
+}
+
+static MDNode* loop_hints(ArrayRef<Metadata *> hints) {
+    // A loop id is a distinct node whose first operand refers to itself
+    SmallVector<Metadata *, 4> operands = { nullptr };
+    operands.append(hints.begin(), hints.end());
+    MDNode *loop_id = MDNode::getDistinct(*TheContext, operands);
+    loop_id->replaceOperandWith(0, loop_id);
+    return loop_id;
+}
+
+// Annotate the branches into and around a loop with its recorded counts,
+// and ask LLVM to unroll and vectorize it if it is hot
+static void annotate_loop(BranchInst *entry, BranchInst *latch, const Counts &counts, bool innermost) {
+    uint64_t entered = std::min(counts.entered, counts.reached);
+    uint64_t iterations = std::max(counts.iterations, entered);
+    if (entry->isConditional()) {
+        entry->setMetadata(LLVMContext::MD_prof, branch_weights(entered, counts.reached - entered));
+    }
+    latch->setMetadata(LLVMContext::MD_prof, branch_weights(iterations - entered, entered));
+
+    std::vector<Metadata *> hints;
+    if (iterations == 0) {
+        // Never executed, don't waste code size on it
+        hints.push_back(MDNode::get(*TheContext, MDString::get(*TheContext, "llvm.loop.unroll.disable")));
+    } else if (iterations >= HotIterations) {
+        if (iterations / std::max(entered, (uint64_t)1) >= 4) {
+            hints.push_back(MDNode::get(*TheContext, MDString::get(*TheContext, "llvm.loop.unroll.enable")));
+        }
+        if (innermost) {
+            hints.push_back(MDNode::get(*TheContext, {
+                MDString::get(*TheContext, "llvm.loop.vectorize.enable"),
+                ConstantAsMetadata::get(ConstantInt::getTrue(*TheContext))
+            }));
+        }
+    }
+
+    if (!hints.empty()) {
+        latch->setMetadata(LLVMContext::MD_loop, loop_hints(hints));
+    }
+}
+}
+
+namespace ClosedForm {
+
+// Loops whose closed form grows beyond this are left alone
+const size_t MAX_TERMS = 32;
+const size_t MAX_DEGREE = 4;
+
+// A monomial is the sorted list of the cells it multiplies,
+// a polynomial maps monomials to their coefficients modulo 256
+typedef std::vector<int64_t> Monomial;
+typedef std::map<Monomial, uint8_t> Polynomial;
+
+static Polynomial constant(uint8_t value) {
+    Polynomial result;
+    if (value != 0) {
+        result[{}] = value;
+    }
+    return result;
+}
+
+static Polynomial variable(int64_t cell) {
+    return {{ { cell }, 1 }};
+}
+
+static Polynomial add(const Polynomial &a, const Polynomial &b) {
+    Polynomial result = a;
+    for (auto &term: b) {
+        uint8_t coefficient = result[term.first] += term.second;
+        if (coefficient == 0) {
+            result.erase(term.first);
+        }
+    }
+    return result;
+}
+
+static Polynomial subtract(const Polynomial &a, const Polynomial &b) {
+    Polynomial negated;
+    for (auto &term: b) {
+        negated[term.first] = -term.second;
+    }
+    return add(a, negated);
+}
+
+static Polynomial multiply(const Polynomial &a, const Polynomial &b) {
+    Polynomial result;
+    for (auto &x: a) {
+        for (auto &y: b) {
+            Monomial monomial;
+            std::merge(x.first.begin(), x.first.end(), y.first.begin(), y.first.end(), std::back_inserter(monomial));
+            result = add(result, {{ monomial, (uint8_t)(x.second * y.second) }});
+        }
+    }
+    return result;
+}
+
+// Replace every cell in `p` with the polynomial `value_of` returns for it
+template <typename ValueOf>
+static Polynomial substitute(const Polynomial &p, ValueOf value_of) {
+    Polynomial result;
+    for (auto &term: p) {
+        Polynomial product = constant(term.second);
+        for (int64_t cell: term.first) {
+            product = multiply(product, value_of(cell));
+        }
+        result = add(result, product);
+    }
+    return result;
+}
+
+static bool uses_any(const Polynomial &p, const std::set<int64_t> &cells) {
+    for (auto &term: p) {
+        for (int64_t cell: term.first) {
+            if (cells.count(cell)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+static bool fits(const Polynomial &p) {
+    if (p.size() > MAX_TERMS) {
+        return false;
+    }
+    for (auto &term: p) {
+        if (term.first.size() > MAX_DEGREE) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Inverse of an odd number modulo 256
+static uint8_t inverse(uint8_t odd) {
+    uint8_t result = odd;
+    for (int i = 0; i < 3; i++) {
+        result *= 2 - odd * result;
+    }
+    return result;
+}
+
+// The cells a piece of straight-line code has modified, as polynomials
+// over the cell values it started with, and where it left the position
+struct State {
+    int64_t offset = 0;
+    std::map<int64_t, Polynomial> cells;
+
+    Polynomial get(int64_t cell) const {
+        auto it = cells.find(cell);
+        return it == cells.end() ? variable(cell) : it->second;
+    }
+
+    bool set(int64_t cell, Polynomial value) {
+        if (!fits(value)) {
+            return false;
+        }
+        cells[cell] = std::move(value);
+        return true;
+    }
+};
+
+// The final values of the cells a loop modifies, over the cell
+// values it started with. A guarded effect only holds if the loop is
+// entered at all.
+struct LoopEffect {
+    std::map<int64_t, Polynomial> values;
+    bool guarded = false;
+};
+
+// Apply the effect of a loop at the current position of `state`
+static bool apply(const LoopEffect &effect, State &state) {
+    if (effect.guarded) {
+        return false;
+    }
+    std::map<int64_t, Polynomial> values;
+    for (auto &value: effect.values) {
+        values[state.offset + value.first] = substitute(value.second, [&](int64_t cell) {
+            return state.get(state.offset + cell);
+        });
+    }
+    for (auto &value: values) {
+        if (!state.set(value.first, value.second)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Derive the effect of a whole loop from the effect of one iteration
+static bool solve(const State &body, LoopEffect &effect) {
+    if (body.offset != 0) {
+        return false;
+    }
+
+    // The loop counter has to change by an odd amount, so that
+    // it reaches zero after `iterations` = c0 / -step iterations
+    Polynomial step = subtract(body.get(0), variable(0));
+    if (step.size() != 1 || !step.count({}) || step.at({}) % 2 == 0) {
+        return false;
+    }
+    Polynomial iterations = multiply(variable(0), constant(inverse(-step.at({}))));
+
+    std::set<int64_t> modified;
+    for (auto &cell: body.cells) {
+        if (cell.second != variable(cell.first)) {
+            modified.insert(cell.first);
+        }
+    }
+
+    // Cells set to a value computed only from cells the loop doesn't modify
+    std::map<int64_t, Polynomial> set_cells;
+    for (int64_t cell: modified) {
+        if (cell != 0 && !uses_any(body.get(cell), modified)) {
+            set_cells[cell] = body.get(cell);
+        }
+    }
+
+    // Every iteration after the first starts with the set cells at these
+    // values, so the other cells change by the same amount every time
+    std::map<int64_t, Polynomial> increments;
+    std::set<int64_t> changing = { 0 };
+    for (int64_t cell: modified) {
+        if (cell == 0 || set_cells.count(cell)) {
+            continue;
+        }
+        Polynomial increment = substitute(subtract(body.get(cell), variable(cell)), [&](int64_t other) {
+            return set_cells.count(other) ? set_cells[other] : variable(other);
+        });
+        if (!increment.empty()) {
+            increments[cell] = increment;
+            changing.insert(cell);
+        }
+    }
+    for (auto &increment: increments) {
+        if (uses_any(increment.second, changing)) {
+            return false;
+        }
+    }
+
+    effect.values.clear();
+    if (set_cells.empty()) {
+        for (auto &increment: increments) {
+            effect.values[increment.first] = add(
+                variable(increment.first),
+                multiply(iterations, increment.second)
+            );
+        }
+        effect.guarded = false;
+    } else {
+        // Peel the first iteration, the rest start from the cells it leaves behind
+        Polynomial remaining = subtract(iterations, constant(1));
+        for (int64_t cell: modified) {
+            Polynomial value = body.get(cell);
+            auto increment = increments.find(cell);
+            if (increment != increments.end()) {
+                value = add(value, multiply(remaining, substitute(increment->second, [&](int64_t other) {
+                    return body.get(other);
+                })));
+            }
+            effect.values[cell] = value;
+        }
+        effect.guarded = true;
+    }
+    effect.values[0] = constant(0);
+
+    for (auto &value: effect.values) {
+        if (!fits(value.second)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Emit IR computing `p` from the values of the cells it uses
+static Value* evaluate(const Polynomial &p, std::map<int64_t, Value *> &cells) {
+    Value *result = ConstantInt::get(Type::getInt8Ty(*TheContext), 0);
+    for (auto &term: p) {
+        Value *product = ConstantInt::get(Type::getInt8Ty(*TheContext), term.second);
+        for (int64_t cell: term.first) {
+            product = Builder->CreateMul(product, cells.at(cell), "term");
+        }
+        result = Builder->CreateAdd(result, product, "closed form");
+    }
+    return result;
+}
+}
+
+namespace Ast {
+class Node;
+}
+
+namespace EGraph {
+
+// Rewriting stops adding nodes once the graph has this many,
+// saturation also stops after this many rounds
+const size_t MAX_NODES = 5000;
+const unsigned MAX_ITERATIONS = 16;
+
+// Number of nodes of a scope that are rewritten together
+const size_t WINDOW = 24;
+
+// A program is a cons-list of operations, each of
+// which holds the class of the rest of the program
+enum Op {
+    NIL,
+    // c[offset] += value
+    ADD,
+    // c[offset] = value
+    SET,
+    // position += offset
+    MOVE,
+    // c[offset] += c[source] * value
+    MUL_ADD,
+    // [ body ] with the loop's source offset in `offset`
+    LOOP,
+    // Any other node, `offset` indexes Graph::opaque
+    OPAQUE,
+};
+
+struct ENode {
+    Op op;
+    int64_t offset;
+    int64_t source;
+    uint8_t value;
+    // The rest of the program last, a loop's body before it
+    std::vector<unsigned> children;
+
+    unsigned rest() const {
+        return children.back();
+    }
+
+    bool operator<(const ENode &other) const {
+        return std::tie(op, offset, source, value, children)
+            < std::tie(other.op, other.offset, other.source, other.value, other.children);
+    }
+
+    bool operator==(const ENode &other) const {
+        return !(*this < other) && !(other < *this);
+    }
+};
+
+static ENode make(Op op, int64_t offset, int64_t source, uint8_t value, std::vector<unsigned> children) {
+    return { op, offset, source, value, std::move(children) };
+}
+
+static ENode with_rest(ENode node, unsigned rest) {
+    node.children.back() = rest;
+    return node;
+}
+
+// Classes of equivalent programs, kept in a union-find
+class Graph {
+    std::vector<unsigned> parents;
+    std::vector<std::vector<ENode>> classes;
+    std::map<ENode, unsigned> memo;
+    std::set<ENode> rewritten;
+    std::set<unsigned> grown;
+    size_t node_count = 0;
+
+public:
+    // The nodes that OPAQUE operations stand for
+    std::vector<Ast::Node *> opaque;
+
+    unsigned find(unsigned id) {
+        while (parents[id] != id) {
+            id = parents[id] = parents[parents[id]];
+        }
+        return id;
+    }
+
+    ENode canonical(ENode node) {
+        for (auto &child: node.children) {
+            child = find(child);
+        }
+        return node;
+    }
+
+    unsigned add(ENode node) {
+        node = canonical(node);
+        auto it = memo.find(node);
+        if (it != memo.end()) {
+            return find(it->second);
+        }
+        unsigned id = parents.size();
+        parents.push_back(id);
+        classes.push_back({ node });
+        memo[node] = id;
+        node_count++;
+        return id;
+    }
+
+    // Whether the rules haven't been applied to `node` yet
+    bool first_visit(const ENode &node) {
+        return rewritten.insert(canonical(node)).second;
+    }
+
+    // The classes that merges added nodes to since the last call
+    std::set<unsigned> take_grown() {
+        std::set<unsigned> result;
+        for (unsigned id: grown) {
+            result.insert(find(id));
+        }
+        grown.clear();
+        return result;
+    }
+
+    // Add an operation read from the program, folding it into the one
+    // after it if both add to the same cell or both move. Saturation would
+    // find the same, but runs like >>>> would grow the graph quadratically.
+    unsigned add_folded(ENode node) {
+        unsigned rest = find(node.rest());
+        if ((node.op == ADD || node.op == MOVE) && classes[rest].size() == 1) {
+            const ENode &next = classes[rest][0];
+            if (next.op == node.op && (node.op == MOVE || next.offset == node.offset)) {
+                ENode folded = next;
+                if (node.op == MOVE) {
+                    folded.offset += node.offset;
+                } else {
+                    folded.value += node.value;
+                }
+                node = folded;
+            }
+        }
+        if ((node.op == ADD && node.value == 0) || (node.op == MOVE && node.offset == 0)) {
+            return node.rest();
+        }
+        return add(std::move(node));
+    }
+
+    unsigned add_opaque(Ast::Node *node, unsigned rest) {
+        opaque.push_back(node);
+        return add(make(OPAQUE, opaque.size() - 1, 0, 0, { rest }));
+    }
+
+    // Returns false if both were already known to be equal
+    bool merge(unsigned a, unsigned b) {
+        a = find(a);
+        b = find(b);
+        if (a == b) {
+            return false;
+        }
+        if (classes[a].size() < classes[b].size()) {
+            std::swap(a, b);
+        }
+        parents[b] = a;
+        grown.insert(a);
+        classes[a].insert(classes[a].end(), classes[b].begin(), classes[b].end());
+        classes[b].clear();
+        return true;
+    }
+
+    // Merging classes can make nodes in different classes equal,
+    // merge those too until every node is in exactly one class
+    void rebuild() {
+        if (grown.empty()) {
+            // Only new classes since the last call, nothing to repair
+            return;
+        }
+        bool merged = true;
+        while (merged) {
+            merged = false;
+            memo.clear();
+            std::vector<std::pair<unsigned, unsigned>> equal;
+            for (unsigned id = 0; id < classes.size(); id++) {
+                for (auto &node: classes[id]) {
+                    node = canonical(node);
+                    auto inserted = memo.insert({ node, id });
+                    if (!inserted.second) {
+                        equal.push_back({ inserted.first->second, id });
+                    }
+                }
+            }
+            for (auto &pair: equal) {
+                merged |= merge(pair.first, pair.second);
+            }
+        }
+
+        node_count = 0;
+        for (auto &nodes: classes) {
+            std::sort(nodes.begin(), nodes.end());
+            nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+            node_count += nodes.size();
+        }
+    }
+
+    size_t size() const {
+        return node_count;
+    }
+
+    size_t class_count() const {
+        return classes.size();
+    }
+
+    // A copy, adding nodes invalidates references into the graph
+    std::vector<ENode> nodes(unsigned id) {
+        return classes[find(id)];
+    }
+
+    const std::vector<ENode>& nodes_ref(unsigned id) {
+        return classes[find(id)];
+    }
+};
+
+// How far the rules below look past intermediate operations
+const unsigned MAX_DISTANCE = 32;
+
+// Operations on single cells
+static bool is_cell_op(const ENode &node) {
+    return node.op == ADD || node.op == SET || node.op == MUL_ADD;
+}
+
+// Whether two cell operations can be swapped
+static bool independent(const ENode &a, const ENode &b) {
+    if (a.offset == b.offset) {
+        return false;
+    }
+    if (a.op == MUL_ADD && a.source == b.offset) {
+        return false;
+    }
+    if (b.op == MUL_ADD && b.source == a.offset) {
+        return false;
+    }
+    return true;
+}
+
+// Find a loop body that only adds constants to cells, summing them up.
+// All such bodies in a class add the same, so a class that didn't lead
+// to one the first time around won't the next time either.
+static bool find_adds(Graph &graph, unsigned id, std::map<int64_t, uint8_t> &adds, std::set<unsigned> &visited) {
+    if (visited.size() >= MAX_DISTANCE || !visited.insert(graph.find(id)).second) {
+        return false;
+    }
+    for (auto &node: graph.nodes(id)) {
+        if (node.op == NIL) {
+            return true;
+        }
+        if (node.op == ADD && node.value != 0) {
+            adds[node.offset] += node.value;
+            if (find_adds(graph, node.rest(), adds, visited)) {
+                return true;
+            }
+            adds[node.offset] -= node.value;
+        }
+    }
+    return false;
+}
+
+// [->+++>+<<] adds 3 * c[0] to c[1], c[0] to c[2] and clears c[0].
+// MultiplyAddNode keeps the loop's test, c[1] and c[2] are only
+// accessed if c[0] isn't zero.
+static bool multiply_loop(Graph &graph, const ENode &loop, unsigned &result) {
+    std::map<int64_t, uint8_t> adds;
+    std::set<unsigned> visited;
+    if (!find_adds(graph, loop.children[0], adds, visited)) {
+        return false;
+    }
+    uint8_t step = adds[0];
+    if (step % 2 == 0) {
+        return false;
+    }
+    uint8_t iterations = ClosedForm::inverse(-step);
+
+    result = graph.add(make(SET, 0, 0, 0, { loop.rest() }));
+    for (auto &add: adds) {
+        if (add.first != 0 && add.second != 0) {
+            result = graph.add(make(MUL_ADD, add.first, 0, add.second * iterations, { result }));
+        }
+    }
+    return true;
+}
+
+// The first cell operation in a class, if there is one
+static bool find_cell_op(Graph &graph, unsigned id, ENode &result) {
+    for (auto &node: graph.nodes_ref(id)) {
+        if (is_cell_op(node)) {
+            result = node;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Rebuild `skipped` in front of `rest`
+static unsigned prepend(Graph &graph, const std::vector<ENode> &skipped, unsigned rest) {
+    for (auto it = skipped.rbegin(); it != skipped.rend(); it++) {
+        rest = graph.add(with_rest(*it, rest));
+    }
+    return rest;
+}
+
+// Folding and known values: bring the next operation on the same cell
+// forward past independent ones and combine it with `node`
+static bool combine(Graph &graph, unsigned self, const ENode &node, unsigned &result) {
+    std::vector<ENode> skipped;
+    std::set<unsigned> seen = { graph.find(self) };
+    unsigned id = node.rest();
+    ENode next;
+    for (unsigned i = 0; i < MAX_DISTANCE && seen.insert(graph.find(id)).second && find_cell_op(graph, id, next); i++) {
+        unsigned after = next.rest();
+
+        if (next.offset == node.offset && node.op != MUL_ADD) {
+            if (next.op == SET) {
+                // The first write is dead
+                result = prepend(graph, skipped, id);
+                return true;
+            }
+            if (next.op == ADD) {
+                ENode folded = with_rest(node, prepend(graph, skipped, after));
+                folded.value += next.value;
+                result = graph.add(folded);
+                return true;
+            }
+        }
+        if (node.op == SET && next.op == MUL_ADD && next.source == node.offset && next.offset != node.offset) {
+            // Multiplying a known value
+            ENode added = make(ADD, next.offset, 0, node.value * next.value, { after });
+            skipped.push_back(added);
+            result = graph.add(with_rest(node, prepend(graph, skipped, after)));
+            return true;
+        }
+
+        if (!independent(node, next)) {
+            return false;
+        }
+        skipped.push_back(next);
+        id = after;
+    }
+    return false;
+}
+
+// Offset shifting: sink a move past the cell operations after it,
+// adjusting their offsets, and fold it into the next move
+static bool sink_move(Graph &graph, const ENode &move, unsigned &result) {
+    std::vector<ENode> shifted;
+    std::set<unsigned> seen;
+    unsigned id = move.rest();
+    ENode next;
+    while (shifted.size() < MAX_DISTANCE && seen.insert(graph.find(id)).second && find_cell_op(graph, id, next)) {
+        next.offset += move.offset;
+        if (next.op == MUL_ADD) {
+            next.source += move.offset;
+        }
+        shifted.push_back(next);
+        id = next.rest();
+    }
+    if (shifted.empty()) {
+        return false;
+    }
+
+    // Only worth it if the move folds into the next one, anything
+    // else is the same program with different offsets
+    for (auto &node: graph.nodes(id)) {
+        if (node.op == MOVE) {
+            unsigned rest = graph.add(make(MOVE, move.offset + node.offset, 0, 0, { node.rest() }));
+            result = prepend(graph, shifted, rest);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Apply the rewrite rules to every node once. The rules that walk
+// down the program only look at a node again if what follows it grew.
+// Returns false if nothing changed.
+static bool rewrite(Graph &graph) {
+    std::vector<std::pair<unsigned, unsigned>> equal;
+    std::set<unsigned> grown = graph.take_grown();
+    size_t classes = graph.class_count();
+    for (unsigned id = 0; id < classes; id++) {
+        if (graph.find(id) != id) {
+            continue;
+        }
+        for (auto &node: graph.nodes(id)) {
+            if (graph.size() >= MAX_NODES) {
+                break;
+            }
+            if (node.op == NIL) {
+                continue;
+            }
+            unsigned rest = node.rest();
+            unsigned rewritten;
+
+            // Operations that do nothing
+            if ((node.op == ADD || node.op == MUL_ADD) && node.value == 0) {
+                equal.push_back({ id, rest });
+            }
+            if (node.op == MOVE && node.offset == 0) {
+                equal.push_back({ id, rest });
+            }
+
+            if (graph.first_visit(node) || grown.count(graph.find(rest))) {
+                if (is_cell_op(node) && combine(graph, id, node, rewritten)) {
+                    equal.push_back({ id, rewritten });
+                }
+                if (node.op == MOVE && sink_move(graph, node, rewritten)) {
+                    equal.push_back({ id, rewritten });
+                }
+                if (node.op == LOOP && multiply_loop(graph, node, rewritten)) {
+                    equal.push_back({ id, rewritten });
+                }
+            }
+
+            for (auto &next: graph.nodes(rest)) {
+                if (node.op == MOVE && next.op == MOVE) {
+                    equal.push_back({ id, graph.add(make(MOVE, node.offset + next.offset, 0, 0, { next.rest() })) });
+                }
+
+                // Known values, a loop is skipped if its cell is zero
+                if (node.op == SET && node.offset == 0 && node.value == 0 && next.op == LOOP) {
+                    equal.push_back({ id, graph.add(with_rest(node, next.rest())) });
+                }
+                if (node.op == LOOP && next.op == LOOP) {
+                    equal.push_back({ id, graph.add(with_rest(node, next.rest())) });
+                }
+            }
+        }
+    }
+
+    bool changed = graph.class_count() != classes;
+    for (auto &pair: equal) {
+        changed |= graph.merge(pair.first, pair.second);
+    }
+    graph.rebuild();
+    return changed;
+}
+
+static void saturate(Graph &graph) {
+    for (unsigned i = 0; i < MAX_ITERATIONS && graph.size() < MAX_NODES; i++) {
+        if (!rewrite(graph)) {
+            break;
+        }
+    }
+}
+
+// Pick the cheapest node of every class. Loops are assumed to
+// run a few times, so their bodies count for more.
+static std::map<unsigned, ENode> extract(Graph &graph) {
+    const uint64_t infinite = UINT64_MAX;
+    std::vector<uint64_t> costs(graph.class_count(), infinite);
+    std::map<unsigned, ENode> best;
+
+    auto cost_of = [&](const ENode &node) {
+        uint64_t cost = 0;
+        for (unsigned child: node.children) {
+            if (costs[graph.find(child)] == infinite) {
+                return infinite;
+            }
+        }
+        switch (node.op) {
+            case NIL:
+                return cost;
+            case MUL_ADD:
+                cost = 2;
+                break;
+            case LOOP:
+                cost = 4 + 8 * costs[graph.find(node.children[0])];
+                break;
+            default:
+                cost = 1;
+                break;
+        }
+        return cost + costs[graph.find(node.rest())];
+    };
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (unsigned id = 0; id < graph.class_count(); id++) {
+            if (graph.find(id) != id) {
+                continue;
+            }
+            for (auto &node: graph.nodes(id)) {
+                uint64_t cost = cost_of(node);
+                if (cost < costs[id]) {
+                    costs[id] = cost;
+                    best[id] = node;
+                    changed = true;
+                }
+            }
+        }
+    }
+    return best;
+}
+}
+
+namespace Idioms {
+
+// What a cell holds after a divmod idiom ran
+enum Result {
+    ZERO,
+    DIVIDEND,
+    DIVISOR_MINUS_REMAINDER,
+    REMAINDER,
+    QUOTIENT,
+};
+
+// A well-known divmod loop. The cell offsets are relative to the
+// loop counter, which holds the dividend.
+struct DivMod {
+    const char *name;
+    const char *loop;
+    int64_t divisor;
+    // Divisors below this don't give the documented results
+    unsigned min_divisor;
+    // Cells the idiom only works for if they start out zero
+    std::vector<int64_t> zero_cells;
+    std::vector<std::pair<int64_t, Result>> results;
+};
+
+static const DivMod Library[] = {
+    // n 0 d 0 0 0 0 -> 0 n d-n%d n%d n/d 0 0
+    {
+        "divmod",
+        "[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]",
+        2,
+        2,
+        { 1, 3, 4, 5, 6 },
+        { { 0, ZERO }, { 1, DIVIDEND }, { 2, DIVISOR_MINUS_REMAINDER }, { 3, REMAINDER }, { 4, QUOTIENT } },
+    },
+};
+
+// Swap the direction of every move in a piece of source
+static std::string mirror(StringRef source) {
+    std::string result = source.str();
+    for (char &c: result) {
+        if (c == '<') {
+            c = '>';
+        } else if (c == '>') {
+            c = '<';
+        }
+    }
+    return result;
+}
+
+// Find the idiom a loop's source matches. Idioms also match with all
+// moves mirrored, `direction` is -1 in that case.
+static const DivMod* match(StringRef source, int64_t &direction) {
+    for (auto &idiom: Library) {
+        if (source == idiom.loop) {
+            direction = 1;
+            return &idiom;
+        }
+        if (source == mirror(idiom.loop)) {
+            direction = -1;
+            return &idiom;
+        }
+    }
+    return nullptr;
+}
+}
+
+namespace Analysis {
+
+// Loop heads that still change after this many iterations are
+// widened to anything they could grow to, so that the analysis ends
+const unsigned WIDEN_AFTER = 3;
+
+// The values a cell may hold, from `low` to `high`
+struct Range {
+    uint8_t low;
+    uint8_t high;
+
+    static Range constant(uint8_t value) {
+        return { value, value };
+    }
+
+    static Range unknown() {
+        return { 0, 255 };
+    }
+
+    bool may_be_zero() const {
+        return low == 0;
+    }
+
+    bool may_be_nonzero() const {
+        return high != 0;
+    }
+
+    bool is_constant() const {
+        return low == high;
+    }
+
+    bool contains(Range other) const {
+        return low <= other.low && other.high <= high;
+    }
+
+    bool operator==(Range other) const {
+        return low == other.low && high == other.high;
+    }
+
+    bool operator!=(Range other) const {
+        return !(*this == other);
+    }
+};
+
+static Range join(Range a, Range b) {
+    return { std::min(a.low, b.low), std::max(a.high, b.high) };
+}
+
+// a + b modulo 256
+static Range add(Range a, Range b) {
+    unsigned low = a.low + b.low;
+    unsigned high = a.high + b.high;
+    if (high <= 255) {
+        return { (uint8_t)low, (uint8_t)high };
+    }
+    if (low >= 256) {
+        return { (uint8_t)(low - 256), (uint8_t)(high - 256) };
+    }
+    return Range::unknown();
+}
+
+// a * b modulo 256
+static Range multiply(Range a, Range b) {
+    if (a.is_constant() && b.is_constant()) {
+        return Range::constant(a.low * b.low);
+    }
+    unsigned high = a.high * b.high;
+    if (high <= 255) {
+        return { (uint8_t)(a.low * b.low), (uint8_t)high };
+    }
+    return Range::unknown();
+}
+
+// The positions the head may be at, relative to the one the program
+// starts at. LOWEST and HIGHEST stand for no bound at all.
+const int64_t LOWEST = INT64_MIN;
+const int64_t HIGHEST = INT64_MAX;
+
+struct Positions {
+    int64_t low;
+    int64_t high;
+
+    bool is_exact() const {
+        return low == high;
+    }
+
+    Positions shift(int64_t delta) const {
+        return {
+            low == LOWEST ? LOWEST : low + delta,
+            high == HIGHEST ? HIGHEST : high + delta,
+        };
+    }
+
+    bool operator==(const Positions &other) const {
+        return low == other.low && high == other.high;
+    }
+};
+
+// Lowest and highest cell the program may access
+static thread_local Positions Footprint = { HIGHEST, LOWEST };
+
+static void note_access(Positions cells) {
+    Footprint = { std::min(Footprint.low, cells.low), std::max(Footprint.high, cells.high) };
+}
+
+// What is known at a point in the program: where the head may be and
+// what the cells may hold. Cells missing from `cells` hold `rest`, the
+// program starts out with all of them zero.
+struct State {
+    bool reachable = true;
+    Positions position = { 0, 0 };
+    std::map<int64_t, Range> cells;
+    Range rest = Range::constant(0);
+
+    Range at(int64_t cell) const {
+        auto it = cells.find(cell);
+        return it == cells.end() ? rest : it->second;
+    }
+
+    // The cell `delta` away from the head
+    Range get(int64_t delta) const {
+        Positions cell = position.shift(delta);
+        note_access(cell);
+        if (cell.is_exact()) {
+            return at(cell.low);
+        }
+        Range result = rest;
+        for (auto it = cells.lower_bound(cell.low); it != cells.end() && it->first <= cell.high; it++) {
+            result = join(result, it->second);
+        }
+        return result;
+    }
+
+    // Without knowing the exact cell, every cell it may be
+    // can hold either its old value or the new one
+    void set(int64_t delta, Range value) {
+        Positions cell = position.shift(delta);
+        note_access(cell);
+        if (cell.is_exact()) {
+            cells[cell.low] = value;
+            return;
+        }
+        for (auto it = cells.lower_bound(cell.low); it != cells.end() && it->first <= cell.high; it++) {
+            it->second = join(it->second, value);
+        }
+        rest = join(rest, value);
+    }
+
+    void move(int64_t delta) {
+        position = position.shift(delta);
+    }
+
+    bool operator==(const State &other) const {
+        return reachable == other.reachable
+            && position == other.position
+            && cells == other.cells
+            && rest == other.rest;
+    }
+};
+
+static State join(const State &a, const State &b) {
+    if (!a.reachable) {
+        return b;
+    }
+    if (!b.reachable) {
+        return a;
+    }
+    State result;
+    result.position = { std::min(a.position.low, b.position.low), std::max(a.position.high, b.position.high) };
+    result.rest = join(a.rest, b.rest);
+    for (auto &cell: a.cells) {
+        result.cells[cell.first] = join(cell.second, b.at(cell.first));
+    }
+    for (auto &cell: b.cells) {
+        result.cells[cell.first] = join(a.at(cell.first), cell.second);
+    }
+    return result;
+}
+
+// Whether everything `inner` allows, `outer` allows as well
+static bool covers(const State &outer, const State &inner) {
+    if (!inner.reachable) {
+        return true;
+    }
+    if (!outer.reachable
+        || inner.position.low < outer.position.low
+        || inner.position.high > outer.position.high
+        || !outer.rest.contains(inner.rest)) {
+        return false;
+    }
+    for (auto &cell: inner.cells) {
+        if (!outer.at(cell.first).contains(cell.second)) {
+            return false;
+        }
+    }
+    for (auto &cell: outer.cells) {
+        if (!cell.second.contains(inner.at(cell.first))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Give up on whatever still changed from `previous` to `next`
+static State widen(const State &previous, const State &next) {
+    State result = next;
+    if (!previous.reachable) {
+        return result;
+    }
+    if (next.position.low < previous.position.low) {
+        result.position.low = LOWEST;
+    }
+    if (next.position.high > previous.position.high) {
+        result.position.high = HIGHEST;
+    }
+    if (next.rest != previous.rest) {
+        result.rest = Range::unknown();
+    }
+    for (auto &cell: result.cells) {
+        if (cell.second != previous.at(cell.first)) {
+            cell.second = Range::unknown();
+        }
+    }
+    return result;
+}
+
+// Continue with the current cell known to be zero
+static void assume_zero(State &state) {
+    if (!state.reachable) {
+        return;
+    }
+    if (!state.get(0).may_be_zero()) {
+        state.reachable = false;
+    } else if (state.position.is_exact()) {
+        state.cells[state.position.low] = Range::constant(0);
+    }
+}
+
+// Continue with the current cell known not to be zero
+static void assume_nonzero(State &state) {
+    if (!state.reachable) {
+        return;
+    }
+    Range value = state.get(0);
+    if (!value.may_be_nonzero()) {
+        state.reachable = false;
+    } else if (state.position.is_exact() && value.low == 0) {
+        state.cells[state.position.low] = { 1, value.high };
+    }
+}
+
+// The values a closed form may compute
+template <typename ValueOf>
+static Range evaluate(const ClosedForm::Polynomial &p, ValueOf value_of) {
+    Range result = Range::constant(0);
+    for (auto &term: p) {
+        Range product = Range::constant(term.second);
+        for (int64_t cell: term.first) {
+            product = multiply(product, value_of(cell));
+        }
+        result = add(result, product);
+    }
+    return result;
+}
+
+// Which ways a check on a cell was seen to go
+enum Outcome {
+    ZERO = 1,
+    NONZERO = 2,
+};
+
+static unsigned outcomes_of(Range value) {
+    return (value.may_be_zero() ? ZERO : 0) | (value.may_be_nonzero() ? NONZERO : 0);
+}
+
+static thread_local bool Ran = false;
+
+// Outcomes of the checks on entering loops (and of idiom guards)
+// and at the end of loop bodies
+static thread_local std::map<const Ast::Node *, unsigned> Entries;
+static thread_local std::map<const Ast::Node *, unsigned> Latches;
+
+// The states loops were last entered and left with
+static thread_local std::map<const Ast::Node *, std::pair<State, State>> Loops;
+
+// The positions nodes may start at
+static thread_local std::map<const Ast::Node *, Positions> Visits;
+
+static void visit(const Ast::Node *node, Positions position) {
+    auto inserted = Visits.insert({ node, position });
+    Positions &joined = inserted.first->second;
+    joined = { std::min(joined.low, position.low), std::max(joined.high, position.high) };
+}
+
+static void record(std::map<const Ast::Node *, unsigned> &checks, const Ast::Node *node, unsigned outcomes) {
+    checks[node] |= outcomes;
+}
+
+// The ways a check may go. Any way if the analysis didn't run, none
+// if the node can't be reached at all.
+static unsigned outcomes(const std::map<const Ast::Node *, unsigned> &checks, const Ast::Node *node) {
+    if (!Ran) {
+        return ZERO | NONZERO;
+    }
+    auto it = checks.find(node);
+    return it == checks.end() ? 0 : it->second;
+}
+
+static void clear() {
+    Ran = false;
+    Entries.clear();
+    Latches.clear();
+    Loops.clear();
+    Visits.clear();
+    Footprint = { HIGHEST, LOWEST };
+}
+}
+
+namespace TapeLayout {
+
+// A tape of `size` cells, the program starting at cell `start`
+struct Layout {
+    uint64_t size;
+    int64_t start;
+    bool mapped;
+
+    // The positions of the first and last cell on the tape
+    int64_t lowest() const {
+        return -start;
+    }
+
+    int64_t highest() const {
+        return (int64_t)size - 1 - start;
+    }
+};
+
+// The layout of the tape of the program being emitted
+static thread_local Layout Current;
+
+// Cells that are mapped on either side of that tape, 0 if the
+// emitted code doesn't map the tape itself
+static thread_local uint64_t Margin = 0;
+
+// Whether a cell up to `distance` cells away from one that is on
+// the tape can be accessed, whether or not it is on the tape itself
+static bool within_margin(int64_t distance) {
+    return (uint64_t)std::abs(distance) <= Margin;
+}
+
+// Size the tape to the cells the analysis found the program may touch.
+// Without a bound on one side, the tape extends to that side instead.
+static Layout plan() {
+    const Analysis::Positions &footprint = Analysis::Footprint;
+    if (Analysis::Ran && footprint.low > footprint.high) {
+        // Never touches a cell
+        return { 1, 0, false };
+    }
+    bool bounded_low = Analysis::Ran && footprint.low != Analysis::LOWEST;
+    bool bounded_high = Analysis::Ran && footprint.high != Analysis::HIGHEST;
+    if (bounded_low && bounded_high) {
+        uint64_t size = footprint.high - footprint.low + 1;
+        return { size, -footprint.low, size > MAX_STACK_TAPE };
+    }
+    if (bounded_low) {
+        return { TapeSize, -footprint.low, true };
+    }
+    if (bounded_high) {
+        return { TapeSize, (int64_t)TapeSize - 1 - footprint.high, true };
+    }
+    return { TapeSize, 0, true };
+}
+
+// Map a zeroed tape. Its pages only take up memory once they're touched.
+static Value* map(uint64_t size) {
+    Type *pointer_type = Type::getInt8PtrTy(*TheContext);
+    Type *int_type = Type::getInt32Ty(*TheContext);
+    Type *size_type = Type::getInt64Ty(*TheContext);
+    FunctionCallee mmap = TheModule->getOrInsertFunction(
+        "mmap",
+        FunctionType::get(pointer_type, { pointer_type, size_type, int_type, int_type, int_type, size_type }, false)
+    );
+    if (Function *function = dyn_cast<Function>(mmap.getCallee())) {
+        function->addRetAttr(Attribute::NoAlias);
+    }
+    Value *tape = Builder->CreateCall(mmap, {
+        ConstantPointerNull::get(cast<PointerType>(pointer_type)),
+        ConstantInt::get(size_type, size),
+        ConstantInt::get(int_type, PROT_READ | PROT_WRITE),
+        ConstantInt::get(int_type, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE),
+        ConstantInt::get(int_type, -1),
+        ConstantInt::get(size_type, 0),
+    }, "tape");
+
+    // Without a tape, all the program can do is say so
+    Function *main = Builder->GetInsertBlock()->getParent();
+    BasicBlock *failed = BasicBlock::Create(*TheContext, "no tape", main);
+    BasicBlock *mapped = BasicBlock::Create(*TheContext, "tape mapped", main);
+    Value *map_failed = ConstantExpr::getIntToPtr(ConstantInt::get(size_type, -1), pointer_type);
+    Builder->CreateCondBr(Builder->CreateICmpEQ(tape, map_failed), failed, mapped);
+
+    Builder->SetInsertPoint(failed);
+    FunctionCallee perror = TheModule->getOrInsertFunction(
+        "perror",
+        FunctionType::get(Builder->getVoidTy(), { pointer_type }, false)
+    );
+    Builder->CreateCall(perror, { Builder->CreateGlobalStringPtr("tape") });
+    Builder->CreateRet(NULL);
+
+    Builder->SetInsertPoint(mapped);
+    return tape;
+}
+
+// The cell the program starts at on a tape
+static Value* get_start(Value *tape) {
+    return Builder->CreateGEP(
+        Type::getInt8Ty(*TheContext),
+        tape,
+        ConstantInt::get(Type::getInt64Ty(*TheContext), Current.start),
+        "tape start"
+    );
+}
+
+static void unmap(Value *tape, uint64_t size) {
+    FunctionCallee munmap = TheModule->getOrInsertFunction(
+        "munmap",
+        FunctionType::get(
+            Type::getInt32Ty(*TheContext),
+            { Type::getInt8PtrTy(*TheContext), Type::getInt64Ty(*TheContext) },
+            false
+        )
+    );
+    Builder->CreateCall(munmap, { tape, ConstantInt::get(Type::getInt64Ty(*TheContext), size) });
+}
+}
+
+namespace BoundsCheck {
+
+// Inside a loop nest whose cells were all checked on entry
+static thread_local bool Covered = false;
+
+// Checks report the offset of the last loop emitted before them
+static thread_local size_t SourceOffset = 0;
+
+static bool enabled() {
+    return BoundsChecks && !Covered;
+}
+
+// Whether the analysis proved that the cells `low` to `high` cells away
+// from any position `node` may start at are on the tape
+static bool proven(const Ast::Node *node, int64_t low, int64_t high) {
+    auto it = Analysis::Visits.find(node);
+    if (it == Analysis::Visits.end()) {
+        return false;
+    }
+    const Analysis::Positions &position = it->second;
+    return position.low != Analysis::LOWEST
+        && position.high != Analysis::HIGHEST
+        && position.low + low >= TapeLayout::Current.lowest()
+        && position.high + high <= TapeLayout::Current.highest();
+}
+
+// Whether the cells from `from` to `to` cells away from `node` are on
+// the tape, knowing that the cell `from` is. Only the side of the tape
+// they extend to has to be bounded.
+static bool proven_from(const Ast::Node *node, int64_t from, int64_t to) {
+    auto it = Analysis::Visits.find(node);
+    if (it == Analysis::Visits.end()) {
+        return false;
+    }
+    const Analysis::Positions &position = it->second;
+    if (to < from) {
+        return position.low != Analysis::LOWEST && position.low + to >= TapeLayout::Current.lowest();
+    }
+    return position.high != Analysis::HIGHEST && position.high + to <= TapeLayout::Current.highest();
+}
+
+// Exit with a diagnostic unless the cells `low` to `high` cells
+// away from the current position are on the tape. A reentrant
+// bf_run() returns BF_OVERRUN instead, its host process goes on.
+static void emit(int64_t low, int64_t high) {
+    Type *position_type = Type::getInt64Ty(*TheContext);
+    Value *position = get_current_position();
+    Value *in_bounds = Builder->CreateAnd(
+        Builder->CreateICmpSGE(position, ConstantInt::get(position_type, TapeLayout::Current.lowest() - low)),
+        Builder->CreateICmpSLE(position, ConstantInt::get(position_type, TapeLayout::Current.highest() - high)),
+        "in bounds"
+    );
+
+    Function *function = Builder->GetInsertBlock()->getParent();
+    BasicBlock *overrun = BasicBlock::Create(*TheContext, "tape overrun", function);
+    BasicBlock *checked = BasicBlock::Create(*TheContext, "checked", function);
+    Builder->CreateCondBr(in_bounds, checked, overrun, MDBuilder(*TheContext).createBranchWeights(1 << 20, 1));
+
+    Builder->SetInsertPoint(overrun);
+    if (IOChannel::Active) {
+        Builder->CreateRet(ConstantInt::get(position_type, BF_OVERRUN));
+        Builder->SetInsertPoint(checked);
+        return;
+    }
+    std::string message = "tape overrun at or after offset " + std::to_string(SourceOffset) + " of the source\n";
+    FunctionCallee write = TheModule->getOrInsertFunction(
+        "write",
+        FunctionType::get(position_type, { Builder->getInt32Ty(), Builder->getInt8PtrTy(), position_type }, false)
+    );
+    std::string name = "overrun message " + std::to_string(SourceOffset);
+    GlobalVariable *text = TheModule->getNamedGlobal(name);
+    if (!text) {
+        text = Builder->CreateGlobalString(message, name);
+    }
+    Builder->CreateCall(write, {
+        Builder->getInt32(STDERR_FILENO),
+        Builder->CreatePointerCast(text, Builder->getInt8PtrTy()),
+        ConstantInt::get(position_type, message.size()),
+    });
+    FunctionCallee exit = TheModule->getOrInsertFunction(
+        "exit",
+        FunctionType::get(Builder->getVoidTy(), { Builder->getInt32Ty() }, false)
+    );
+    if (Function *exit_function = dyn_cast<Function>(exit.getCallee())) {
+        exit_function->setDoesNotReturn();
+    }
+    Builder->CreateCall(exit, { Builder->getInt32(1) });
+    Builder->CreateUnreachable();
+
+    Builder->SetInsertPoint(checked);
+}
+
+// Pass on an overrun reported by an outlined function of bf_run()
+static void forward(Value *position) {
+    Function *function = Builder->GetInsertBlock()->getParent();
+    BasicBlock *overrun = BasicBlock::Create(*TheContext, "tape overrun", function);
+    BasicBlock *checked = BasicBlock::Create(*TheContext, "checked", function);
+    Value *failed = Builder->CreateICmpEQ(position, ConstantInt::get(position->getType(), BF_OVERRUN), "overrun");
+    Builder->CreateCondBr(failed, overrun, checked, MDBuilder(*TheContext).createBranchWeights(1, 1 << 20));
+
+    Builder->SetInsertPoint(overrun);
+    Builder->CreateRet(position);
+    Builder->SetInsertPoint(checked);
+}
+}
+
+namespace ForkServer {
+
+// The pipes of AFL's fork server protocol
+const int CONTROL_FD = 198;
+const int STATUS_FD = CONTROL_FD + 1;
+
+// Emit a fork server loop into main(), after the tape is set up. When
+// the process was started by a driver that talks the protocol, main()
+// forks a child for every 4-byte request on the control pipe, which runs
+// the program on a copy of the fresh tape, and answers with the child's
+// pid and then its wait status. Otherwise the hello message can't be
+// written and the program runs right away.
+static void emit() {
+    Type *int_type = Builder->getInt32Ty();
+    Type *size_type = Builder->getInt64Ty();
+    Type *pointer_type = Builder->getInt8PtrTy();
+    FunctionType *io_type = FunctionType::get(size_type, { int_type, pointer_type, size_type }, false);
+    FunctionCallee write = TheModule->getOrInsertFunction("write", io_type);
+    FunctionCallee read = TheModule->getOrInsertFunction("read", io_type);
+    FunctionCallee fork = TheModule->getOrInsertFunction("fork", FunctionType::get(int_type, false));
+    FunctionCallee waitpid = TheModule->getOrInsertFunction(
+        "waitpid",
+        FunctionType::get(int_type, { int_type, int_type->getPointerTo(), int_type }, false)
+    );
+    FunctionCallee close = TheModule->getOrInsertFunction("close", FunctionType::get(int_type, { int_type }, false));
+    FunctionCallee exit = TheModule->getOrInsertFunction(
+        "_exit",
+        FunctionType::get(Builder->getVoidTy(), { int_type }, false)
+    );
+    if (Function *exit_function = dyn_cast<Function>(exit.getCallee())) {
+        exit_function->setDoesNotReturn();
+    }
+
+    // Mapping the tape may have branched, keep the buffers static
+    Function *main = Builder->GetInsertBlock()->getParent();
+    IRBuilder<> entry(&main->getEntryBlock(), main->getEntryBlock().begin());
+    Value *message = entry.CreateAlloca(int_type, nullptr, "fork server message");
+    Value *status = entry.CreateAlloca(int_type, nullptr, "child status");
+    Value *message_bytes = Builder->CreateBitCast(message, pointer_type);
+    Value *status_bytes = Builder->CreateBitCast(status, pointer_type);
+    Value *message_size = ConstantInt::get(size_type, 4);
+
+    BasicBlock *serve = BasicBlock::Create(*TheContext, "fork server", main);
+    BasicBlock *spawn = BasicBlock::Create(*TheContext, "fork", main);
+    BasicBlock *child = BasicBlock::Create(*TheContext, "fork child", main);
+    BasicBlock *started = BasicBlock::Create(*TheContext, "child started", main);
+    BasicBlock *waited = BasicBlock::Create(*TheContext, "child exited", main);
+    BasicBlock *done = BasicBlock::Create(*TheContext, "fork server done", main);
+    BasicBlock *failed = BasicBlock::Create(*TheContext, "fork server failed", main);
+    BasicBlock *program = BasicBlock::Create(*TheContext, "program", main);
+
+    Builder->CreateStore(Builder->getInt32(0), message);
+    Value *hello = Builder->CreateCall(write, { Builder->getInt32(STATUS_FD), message_bytes, message_size }, "hello");
+    Builder->CreateCondBr(Builder->CreateICmpEQ(hello, message_size), serve, program);
+
+    // The driver closes the control pipe when it's done
+    Builder->SetInsertPoint(serve);
+    Value *request = Builder->CreateCall(
+        read,
+        { Builder->getInt32(CONTROL_FD), message_bytes, message_size },
+        "request"
+    );
+    Builder->CreateCondBr(Builder->CreateICmpEQ(request, message_size), spawn, done);
+
+    Builder->SetInsertPoint(spawn);
+    Value *pid = Builder->CreateCall(fork, {}, "pid");
+    SwitchInst *forked = Builder->CreateSwitch(pid, started);
+    forked->addCase(Builder->getInt32(0), child);
+    forked->addCase(Builder->getInt32(-1), failed);
+
+    Builder->SetInsertPoint(child);
+    Builder->CreateCall(close, { Builder->getInt32(CONTROL_FD) });
+    Builder->CreateCall(close, { Builder->getInt32(STATUS_FD) });
+    Builder->CreateBr(program);
+
+    Builder->SetInsertPoint(started);
+    Builder->CreateStore(pid, message);
+    Value *sent = Builder->CreateCall(write, { Builder->getInt32(STATUS_FD), message_bytes, message_size }, "sent");
+    Value *waited_for = Builder->CreateCall(waitpid, { pid, status, Builder->getInt32(0) }, "waited");
+    Builder->CreateCondBr(
+        Builder->CreateAnd(Builder->CreateICmpEQ(sent, message_size), Builder->CreateICmpSGE(waited_for, Builder->getInt32(0))),
+        waited,
+        failed
+    );
+
+    Builder->SetInsertPoint(waited);
+    Value *reported = Builder->CreateCall(write, { Builder->getInt32(STATUS_FD), status_bytes, message_size }, "reported");
+    Builder->CreateCondBr(Builder->CreateICmpEQ(reported, message_size), serve, failed);
+
+    Builder->SetInsertPoint(done);
+    Builder->CreateCall(exit, { Builder->getInt32(0) });
+    Builder->CreateUnreachable();
+
+    Builder->SetInsertPoint(failed);
+    Builder->CreateCall(exit, { Builder->getInt32(1) });
+    Builder->CreateUnreachable();
+
+    Builder->SetInsertPoint(program);
+}
+
+// End main() with exit(0) rather than returning from it. main() is void,
+// so a child that returned would leave the driver whatever happened to be
+// in the return register as its exit status. exit() flushes stdio too.
+static void finish() {
+    FunctionCallee exit = TheModule->getOrInsertFunction(
+        "exit",
+        FunctionType::get(Builder->getVoidTy(), { Builder->getInt32Ty() }, false)
+    );
+    if (Function *exit_function = dyn_cast<Function>(exit.getCallee())) {
+        exit_function->setDoesNotReturn();
+    }
+    Builder->CreateCall(exit, { Builder->getInt32(0) });
+    Builder->CreateUnreachable();
+}
+}
+
+namespace Ast {
+
+class Node;
+
+// Every node that was created, so that the tree can be freed all at
+// once. Passes drop nodes they replace and some nodes share subtrees,
+// so freeing it from the root would miss nodes or free them twice.
+static thread_local std::vector<Node *> AllNodes;
+
+static void free_nodes();
+
+class Node {
+public:
+    // Discriminator for LLVM-style RTTI (isa<>, dyn_cast<>)
+    enum NodeKind {
+        NK_Increment,
+        NK_Decrement,
+        NK_MoveLeft,
+        NK_MoveRight,
+        NK_PutChar,
+        NK_GetChar,
+        NK_ClearRange,
+        NK_TransferChain,
+        NK_ClosedFormLoop,
+        NK_DivMod,
+        NK_Add,
+        NK_Set,
+        NK_Move,
+        NK_MultiplyAdd,
+        NK_Scope,
+        NK_Program = NK_Scope,
+        NK_ConditionalGroup,
+        NK_LastScope = NK_ConditionalGroup,
+    };
+
+private:
+    const NodeKind kind;
+
+public:
+    explicit Node(NodeKind kind): kind(kind) {
+        AllNodes.push_back(this);
+    };
+
+    Node(const Node &) = delete;
+
+    virtual ~Node() = default;
+
+    NodeKind getKind() const {
+        return kind;
+    }
+
+    static Node* try_parse(std::istream&);
+
+    virtual void debug_print(std::ostream &out)=0;
+    virtual void codegen()=0;
+
+    // Record the cells this node accesses relative to `offset`, mapped to
+    // whether it may write them, and advance `offset` past its movement.
+    // Returns false if the accessed cells are not known statically.
+    virtual bool collect_accessed_cells(int64_t &offset, std::map<int64_t, bool> &cells)=0;
+
+    // Apply the effect of this node to `state` symbolically.
+    // Returns false if it can't be expressed as polynomials.
+    virtual bool execute_symbolically(ClosedForm::State &state) {
+        return false;
+    }
+
+    // Apply the effect of this node to what is known about the cells
+    // and the position, `state` is reachable
+    virtual void analyze(Analysis::State &state)=0;
+
+    // Add this node in front of the program `rest` to an e-graph
+    virtual unsigned add_to_egraph(EGraph::Graph &graph, unsigned rest) {
+        return graph.add_opaque(this, rest);
+    }
+
+    // Number of nodes in this subtree
+    virtual size_t count_nodes() {
+        return 1;
+    }
+
+};
+
+// +
+class IncrementNode: public Node {
+public:
+    IncrementNode(): Node(NK_Increment) {};
+
+    static bool classof(const Node *node) {
+        return node->getKind() == NK_Increment;
+    }
+
+    void debug_print(std::ostream &out) override {
+        out << "+";
+    }
+
+    bool collect_accessed_cells(int64_t &offset, std::map<int64_t, bool> &cells) override {
+        cells[offset] = true;
+        return true;
+    }
+
+    bool execute_symbolically(ClosedForm::State &state) override {
+        return state.set(state.offset, ClosedForm::add(state.get(state.offset), ClosedForm::constant(1)));
+    }
+
+    void analyze(Analysis::State &state) override {
+        state.set(0, Analysis::add(state.get(0), Analysis::Range::constant(1)));
+    }
+
+    unsigned add_to_egraph(EGraph::Graph &graph, unsigned rest) override {
+        return graph.add_folded(EGraph::make(EGraph::ADD, 0, 0, 1, { rest }));
+    }
+
+    void codegen() override {
+        // Load the current value in the cell
+        Value* tape_cell = load_current_cell();
+
+        // Increment the value
+        Value *to_add = ConstantInt::get(Type::getInt8Ty(*TheContext), 1);
+        Value *new_value = Builder->CreateAdd(tape_cell, to_add, "new tape value");
+
+        // Write back
+        store_current_cell(new_value);
+    };
+};
+
+// -
+class DecrementNode: public Node {
+public:
+    DecrementNode(): Node(NK_Decrement) {};
+
+    static bool classof(const Node *node) {
+        return node->getKind() == NK_Decrement;
+    }
+
+    void debug_print(std::ostream &out) override {
+        out << "-";
+    }
+
+    bool collect_accessed_cells(int64_t &offset, std::map<int64_t, bool> &cells) override {
+        cells[offset] = true;
+        return true;
+    }
+
+    bool execute_symbolically(ClosedForm::State &state) override {
+        return state.set(state.offset, ClosedForm::subtract(state.get(state.offset), ClosedForm::constant(1)));
+    }
+
+    void analyze(Analysis::State &state) override {
+        state.set(0, Analysis::add(state.get(0), Analysis::Range::constant(255)));
+    }
+
+    unsigned add_to_egraph(EGraph::Graph &graph, unsigned rest) override {
+        return graph.add_folded(EGraph::make(EGraph::ADD, 0, 0, 255, { rest }));
+    }
+
+    void codegen() override {
+        // Load the current value in the cell
+        Value* tape_cell = load_current_cell();
+
+        // Decrement the value
+        Value *to_sub = ConstantInt::get(Type::getInt8Ty(*TheContext), 1);
+        Value *new_value = Builder->CreateSub(tape_cell, to_sub, "new tape value");
+
+        // Write back
+        store_current_cell(new_value);
+    };
+};
+
+// <
+class MoveLeftNode: public Node {
+public:
+    MoveLeftNode(): Node(NK_MoveLeft) {};
+
+    static bool classof(const Node *node) {
+        return node->getKind() == NK_MoveLeft;
+    }
+
+    void debug_print(std::ostream &out) override {
+        out << "<";
+    }
+
+    bool collect_accessed_cells(int64_t &offset, std::map<int64_t, bool> &cells) override {
+        offset--;
+        return true;
+    }
+
+    bool execute_symbolically(ClosedForm::State &state) override {
+        state.offset--;
+        return true;
+    }
+
+    void analyze(Analysis::State &state) override {
+        state.move(-1);
+    }
+
+    unsigned add_to_egraph(EGraph::Graph &graph, unsigned rest) override {
+        return graph.add_folded(EGraph::make(EGraph::MOVE, -1, 0, 0, { rest }));
+    }
+
+    void codegen() override {
+        Value *to_sub = ConstantInt::get(Type::getInt64Ty(*TheContext), 1);
+        CurrentPosition = Builder->CreateSub(get_current_position(), to_sub, "next position");
+        CellPromotion::Offset--;
+    };
+};
+
+// > 
+class MoveRightNode: public Node {
+public:
+    MoveRightNode(): Node(NK_MoveRight) {};
+
+    static bool classof(const Node *node) {
+        return node->getKind() == NK_MoveRight;
+    }
+
+    void debug_print(std::ostream &out) override {
+        out << ">";
+    }
+
+    bool collect_accessed_cells(int64_t &offset, std::map<int64_t, bool> &cells) override {
+        offset++;
+        return true;
+    }
+
+    bool execute_symbolically(ClosedForm::State &state) override {
+        state.offset++;
+        return true;
+    }
+
+    void analyze(Analysis::State &state) override {
+        state.move(1);
+    }
+
+    unsigned add_to_egraph(EGraph::Graph &graph, unsigned rest) override {
+        return graph.add_folded(EGraph::make(EGraph::MOVE, 1, 0, 0, { rest }));
+    }
+
+    void codegen() override {
+        Value *to_add = ConstantInt::get(Type::getInt64Ty(*TheContext), 1);
+        CurrentPosition = Builder->CreateAdd(get_current_position(), to_add, "next position");
+        CellPromotion::Offset++;
+    };
+};
+
+// .
+class PutCharNode: public Node {
+public:
+    PutCharNode(): Node(NK_PutChar) {};
+
+    static bool classof(const Node *node) {
+        return node->getKind() == NK_PutChar;
+    }
+
+    void debug_print(std::ostream &out) override {
+        out << ".";
+    }
+
+    bool collect_accessed_cells(int64_t &offset, std::map<int64_t, bool> &cells) override {
+        cells[offset];
+        return true;
+    }
+
+    void analyze(Analysis::State &state) override {
+        state.get(0);
+    }
+
+    void codegen() override {
+        if (IOChannel::Active) {
+            Value *c = Builder->CreateZExt(load_current_cell(), Type::getInt32Ty(*TheContext));
+            TapeMetadata::annotate_call(IOChannel::call(IOChannel::PUT, { c }, "put()"));
+            return;
+        }
+
+        // declare putchar() function
+        FunctionType* putchar_type = FunctionType::get(
+            Type::getInt32Ty(*TheContext),  // returns int
+            { Type::getInt8Ty(*TheContext) },  // single character argument
+            false
+        );
+        FunctionCallee putchar = get_io_function("putchar", putchar_type);
+
+        // Read the cell value at the current position
+        Value *tape_cell = load_current_cell();
+
+        // Call putchar
+        TapeMetadata::annotate_call(Builder->CreateCall(
+            putchar_type, 
+            putchar.getCallee(), 
+            { tape_cell }, 
+            "putchar()"
+        ));
+    };
+};
+
+// ,
+class GetCharNode: public Node {
+public:
+    GetCharNode(): Node(NK_GetChar) {};
+
+    static bool classof(const Node *node) {
+        return node->getKind() == NK_GetChar;
+    }
+
+    void debug_print(std::ostream &out) override {
+        out << ",";
+    }
+
+    bool collect_accessed_cells(int64_t &offset, std::map<int64_t, bool> &cells) override {
+        cells[offset] = true;
+        return true;
+    }
+
+    void analyze(Analysis::State &state) override {
+        state.set(0, Analysis::Range::unknown());
+    }
+
+    Value* codegen_getchar() {
+        if (IOChannel::Active) {
+            return TapeMetadata::annotate_call(IOChannel::call(IOChannel::GET, {}, "get()"));
+        }
+
+        // declare getchar() function
+        FunctionType* getchar_type = FunctionType::get(
+            Type::getInt32Ty(*TheContext),
+            {},
+            false
+        );
+        FunctionCallee getchar = get_io_function("getchar", getchar_type);
+
+        // Call getchar
+        return TapeMetadata::annotate_call(Builder->CreateCall(
+            getchar_type, 
+            getchar.getCallee(), 
+            {}, 
+            "getchar()"
+        ));
+    }
+
+    void codegen() override {
+        Value *c = codegen_getchar();
+
+        // Truncate the value to an i8, so we can store it in the tape cell
+        Value *truncated_char = Builder->CreateIntCast(c, Type::getInt8Ty(*TheContext), true);
+
+        // Write it to the cell at the current position
+        store_current_cell(truncated_char);
+    };
+};
+
+// Nodes that access the same cells whenever they run
+static bool is_straight_line(const Node *node) {
+    switch (node->getKind()) {
+        case Node::NK_ConditionalGroup:
+        case Node::NK_ClosedFormLoop:
+        case Node::NK_DivMod:
+        case Node::NK_MultiplyAdd:
+        case Node::NK_TransferChain:
+            return false;
+        default:
+            return true;
+    }
+}
+
+class ScopeNode: public Node {
+protected:
+    std::vector<Node *> children;
+
+    // Emit IR for each child. LLVM takes much longer than linear time to
+    // optimize big functions, so big scopes are split into chunks of at
+    // most OutlineThreshold nodes that get a function each.
+    void codegen_children(bool reads_end) {
+        if (OutlineThreshold == 0 || CellPromotion::Active || count_nodes() <= OutlineThreshold) {
+            codegen_range(0, children.size(), reads_end);
+            return;
+        }
+        size_t begin = 0;
+        while (begin < children.size()) {
+            size_t end = begin + 1;
+            size_t size = children[begin]->count_nodes();
+            while (end < children.size() && size + children[end]->count_nodes() <= OutlineThreshold) {
+                size += children[end++]->count_nodes();
+            }
+            codegen_outlined(begin, end, reads_end && end == children.size());
+            begin = end;
+        }
+    }
+
+    // Emit the children from `begin` to `end` into a function of their
+    // own, taking the tape and the position (and the I/O channel with
+    // --entry) and returning the new position
+    Function* codegen_function(size_t begin, size_t end, bool reads_end, const std::string &name,
+                               GlobalValue::LinkageTypes linkage) {
+        Type *tape_type = Type::getInt8PtrTy(*TheContext);
+        Type *position_type = Type::getInt64Ty(*TheContext);
+        std::vector<Type *> parameters = { tape_type, position_type };
+        if (IOChannel::Active) {
+            parameters.push_back(IOChannel::get_type()->getPointerTo());
+        }
+        Function *function = Function::Create(
+            FunctionType::get(position_type, parameters, false),
+            linkage,
+            name,
+            *TheModule
+        );
+        function->addFnAttr(Attribute::NoUnwind);
+
+        // Nothing else the function accesses is on the tape
+        function->addParamAttr(0, Attribute::NoAlias);
+        function->addParamAttr(0, Attribute::NonNull);
+        function->addParamAttr(0, Attribute::getWithAlignment(*TheContext, Align(TAPE_ALIGN)));
+        function->addDereferenceableParamAttr(0, TapeLayout::Current.size);
+
+        if (IOChannel::Active) {
+            function->addParamAttr(2, Attribute::NonNull);
+            function->addParamAttr(2, Attribute::ReadOnly);
+            NamedValues["io"] = function->getArg(2);
+        }
+
+        Builder->SetInsertPoint(BasicBlock::Create(*TheContext, "entry", function));
+        NamedValues["tape base"] = function->getArg(0);
+        NamedValues["tape"] = TapeLayout::get_start(function->getArg(0));
+        CurrentPosition = function->getArg(1);
+        codegen_range(begin, end, reads_end);
+        Builder->CreateRet(CurrentPosition);
+        verifyFunction(*function);
+        return function;
+    }
+
+    // Emit the children from `begin` to `end` into a function and call it
+    void codegen_outlined(size_t begin, size_t end, bool reads_end) {
+        Value *tape = NamedValues["tape base"];
+        Value *io = NamedValues["io"];
+        Value *position = CurrentPosition;
+        BasicBlock *caller = Builder->GetInsertBlock();
+
+        Function *function = codegen_function(begin, end, reads_end, "outlined", GlobalValue::InternalLinkage);
+
+        Builder->SetInsertPoint(caller);
+        NamedValues["tape base"] = tape;
+        NamedValues["tape"] = TapeLayout::get_start(tape);
+        NamedValues["io"] = io;
+        std::vector<Value *> arguments = { tape, position };
+        if (IOChannel::Active) {
+            arguments.push_back(io);
+        }
+        CurrentPosition = Builder->CreateCall(function, arguments, "position");
+        if (IOChannel::Active && BoundsChecks) {
+            BoundsCheck::forward(CurrentPosition);
+        }
+    }
+
+    // With bounds checks, a run of straight-line code is checked once
+    // before it starts, loops check themselves. `reads_end` adds the
+    // cell the children end on to the last run.
+    void codegen_range(size_t begin, size_t end, bool reads_end) {
+        size_t i = begin;
+        while (i < end) {
+            if (!BoundsCheck::enabled() || !is_straight_line(children[i])) {
+                children[i++]->codegen();
+                continue;
+            }
+
+            size_t run_end = i;
+            int64_t offset = 0;
+            std::map<int64_t, bool> cells;
+            while (run_end < end && is_straight_line(children[run_end])) {
+                children[run_end++]->collect_accessed_cells(offset, cells);
+            }
+            if (run_end == end && reads_end) {
+                cells[offset];
+            }
+            if (!cells.empty()) {
+                int64_t low = cells.begin()->first;
+                int64_t high = cells.rbegin()->first;
+                if (!BoundsCheck::proven(children[i], low, high)) {
+                    BoundsCheck::emit(low, high);
+                }
+            }
+            while (i < run_end) {
+                children[i++]->codegen();
+            }
+        }
+    }
+
+public:
+    ScopeNode(NodeKind kind, std::vector<Node *> children): Node(kind), children(children) {};
+
+    static bool classof(const Node *node) {
+        return node->getKind() >= NK_Scope && node->getKind() <= NK_LastScope;
+    }
+
+    std::vector<Node *>& get_children() {
+        return children;
+    }
+
+    bool collect_accessed_cells(int64_t &offset, std::map<int64_t, bool> &cells) override {
+        for (auto child: children) {
+            if (!child->collect_accessed_cells(offset, cells)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void analyze(Analysis::State &state) override {
+        for (auto child: children) {
+            if (!state.reachable) {
+                return;
+            }
+            Analysis::visit(child, state.position);
+            child->analyze(state);
+        }
+    }
+
+    size_t count_nodes() override {
+        size_t count = 1;
+        for (auto child: children) {
+            count += child->count_nodes();
+        }
+        return count;
+    }
+
+};
+
+class ProgramNode: public ScopeNode {
+public:
+    explicit ProgramNode(std::vector<Node *> children): ScopeNode(NK_Program, children) {};
+
+    static bool classof(const Node *node) {
+        return node->getKind() == NK_Program;
+    }
+
+    static Ast::Node* try_parse(std::istream&);
+
+    void debug_print(std::ostream &out) override {
+        for (auto child: children) {
+            child->debug_print(out);
+        }
+    }
+
+    void codegen() override {
+        // Setup main function
+        FunctionType *main_type = FunctionType::get(Builder->getVoidTy(), false);
+        Function* main = Function::Create(
+            main_type, 
+            GlobalValue::ExternalLinkage, 
+            "main", 
+            *TheModule
+        );
+
+        // A profile lets LLVM lay out and split code by hotness
+        if (!LoopProfile::Recorded.empty()) {
+            main->setEntryCount(Function::ProfileCount(1, Function::PCT_Real));
+            LoopProfile::set_profile_summary();
+        }
+
+        // Point the builder to the start of the main function
+        BasicBlock *main_block = BasicBlock::Create(*TheContext, "entry", main);
+        Builder->SetInsertPoint(main_block);
+
+        // The position of the write head lives in registers,
+        // loops merge it with phi nodes
+        CurrentPosition = ConstantInt::get(Type::getInt64Ty(*TheContext), 0);
+
+        // Allocate the tape storage, sized to the cells the program may touch
+        TapeLayout::Layout layout = TapeLayout::plan();
+        TapeLayout::Current = layout;
+        TapeMetadata::create();
+        Value *tape;
+        Value *mapping = nullptr;
+        if (layout.mapped) {
+            // Fresh pages are zero already
+            TapeLayout::Margin = TAPE_MARGIN;
+            mapping = TapeLayout::map(layout.size + 2 * TAPE_MARGIN);
+            tape = Builder->CreateGEP(
+                Type::getInt8Ty(*TheContext),
+                mapping,
+                ConstantInt::get(Type::getInt64Ty(*TheContext), TAPE_MARGIN),
+                "tape"
+            );
+        } else {
+            TapeLayout::Margin = 0;
+            Type* tape_type = ArrayType::get(Type::getInt8Ty(*TheContext), layout.size);
+            AllocaInst* stack_tape = Builder->CreateAlloca(
+                tape_type,
+                nullptr,
+                "tape"
+            );
+            stack_tape->setAlignment(Align(TAPE_ALIGN));
+
+            // Zero the tape with a memset, storing a zeroinitializer of the
+            // whole array makes instruction selection crawl
+            Builder->CreateMemSet(
+                stack_tape,
+                ConstantInt::get(Type::getInt8Ty(*TheContext), 0),
+                layout.size,
+                MaybeAlign(TAPE_ALIGN),
+                false,
+                TapeMetadata::TBAATag,
+                TapeMetadata::Scope
+            );
+            tape = Builder->CreateBitCast(stack_tape, Type::getInt8PtrTy(*TheContext));
+        }
+        NamedValues["tape base"] = tape;
+        NamedValues["tape"] = TapeLayout::get_start(tape);
+
+        LoopProfile::Loops.clear();
+        BoundsCheck::SourceOffset = 0;
+
+        if (ForkServerLoop) {
+            ForkServer::emit();
+        }
+
+        codegen_children(false);
+
+        if (LoopProfile::enabled()) {
+            LoopProfile::emit_dump();
+        }
+
+        if (layout.mapped) {
+            TapeLayout::unmap(mapping, layout.size + 2 * TAPE_MARGIN);
+        }
+
+        if (ForkServerLoop) {
+            ForkServer::finish();
+        } else {
+            Builder->CreateRet(NULL);
+        }
+        verifyFunction(*main);
+    }
+
+    // Emit the program as one chunk of a bigger one, into a function
+    // `name` that takes the tape and the position and returns the new
+    // position. The caller sets up the tape.
+    Function* codegen_chunk(const std::string &name) {
+        TapeMetadata::create();
+        return codegen_function(0, children.size(), false, name, GlobalValue::ExternalLinkage);
+    }
+};
+
+// [ ... ]
+class ConditionalGroupNode: public ScopeNode {
+    // Offset of the opening bracket in the source file
+    size_t source_offset;
+
+public:
+    ConditionalGroupNode(std::vector<Node *> children, size_t source_offset):
+        ScopeNode(NK_ConditionalGroup, children), source_offset(source_offset) {};
+
+    static bool classof(const Node *node) {
+        return node->getKind() == NK_ConditionalGroup;
+    }
+
+    static Ast::Node* try_parse(std::istream&);
+
+    void debug_print(std::ostream &out) override {
+        out << '[';
+        for (auto child: children) {
+            child->debug_print(out);
+        }
+        out << ']';
+    }
+
+    bool collect_accessed_cells(int64_t &offset, std::map<int64_t, bool> &cells) override {
+        // The loop condition reads the current cell
+        cells[offset];
+
+        // Only a body that returns to the cell it started at
+        // accesses the same cells on every iteration
+        int64_t body_offset = offset;
+        if (!ScopeNode::collect_accessed_cells(body_offset, cells)) {
+            return false;
+        }
+        return body_offset == offset;
+    }
+
+    // Whether every cell a balanced loop nest may access lies between two
+    // that each iteration touches anyway: its own and those of the
+    // straight-line code in its body. Then loading them all on entry
+    // touches no cell the program doesn't get to.
+    bool touches_range(const std::map<int64_t, bool> &accessed) {
+        int64_t low = 0;
+        int64_t high = 0;
+        int64_t offset = 0;
+        for (Node *child: children) {
+            std::map<int64_t, bool> cells;
+            child->collect_accessed_cells(offset, cells);
+            if (is_straight_line(child) && !cells.empty()) {
+                low = std::min(low, cells.begin()->first);
+                high = std::max(high, cells.rbegin()->first);
+            }
+        }
+        return accessed.begin()->first >= low && accessed.rbegin()->first <= high;
+    }
+
+    // Derive the effect of the whole loop from its body
+    bool closed_form(ClosedForm::LoopEffect &effect) {
+        ClosedForm::State body;
+        for (auto child: children) {
+            if (!child->execute_symbolically(body)) {
+                return false;
+            }
+        }
+        return ClosedForm::solve(body, effect);
+    }
+
+    bool execute_symbolically(ClosedForm::State &state) override {
+        ClosedForm::LoopEffect effect;
+        return closed_form(effect) && ClosedForm::apply(effect, state);
+    }
+
+    unsigned add_to_egraph(EGraph::Graph &graph, unsigned rest) override {
+        // Only loops without nested loops or other opaque nodes
+        // are rewritten as a whole
+        if (any_of(children, [](Node *child) { return isa<ConditionalGroupNode>(child); })) {
+            return graph.add_opaque(this, rest);
+        }
+        size_t opaque = graph.opaque.size();
+        unsigned body = graph.add(EGraph::make(EGraph::NIL, 0, 0, 0, {}));
+        for (auto it = children.rbegin(); it != children.rend(); it++) {
+            body = (*it)->add_to_egraph(graph, body);
+        }
+        if (graph.opaque.size() != opaque) {
+            return graph.add_opaque(this, rest);
+        }
+        return graph.add(EGraph::make(EGraph::LOOP, source_offset, 0, 0, { body, rest }));
+    }
+
+    void analyze(Analysis::State &state) override {
+        // Entering with no more than the last time leaves the loop the
+        // same way. Otherwise go on from both, so that the loops around
+        // this one going round once more don't start it from scratch.
+        auto previous = Analysis::Loops.find(this);
+        if (previous != Analysis::Loops.end()) {
+            if (Analysis::covers(previous->second.first, state)) {
+                state = previous->second.second;
+                return;
+            }
+            state = Analysis::join(previous->second.first, state);
+        }
+        Analysis::State entry = state;
+        Analysis::record(Analysis::Entries, this, Analysis::outcomes_of(state.get(0)));
+
+        // Promoted loop nests load and store every cell they may access
+        // when they are entered and left, even cells the body never gets to
+        std::map<int64_t, bool> accessed;
+        int64_t offset = 0;
+        if (collect_accessed_cells(offset, accessed)) {
+            for (auto &cell: accessed) {
+                Analysis::note_access(state.position.shift(cell.first));
+            }
+        }
+
+        // Run the body until the states at its start stop changing,
+        // every time it ends on a zero cell is a way out of the loop
+        Analysis::State exit = state;
+        Analysis::assume_zero(exit);
+        Analysis::State head = state;
+        Analysis::assume_nonzero(head);
+        for (unsigned iteration = 0; head.reachable; iteration++) {
+            Analysis::State body = head;
+            ScopeNode::analyze(body);
+            if (!body.reachable) {
+                break;
+            }
+            Analysis::record(Analysis::Latches, this, Analysis::outcomes_of(body.get(0)));
+
+            Analysis::State left = body;
+            Analysis::assume_zero(left);
+            exit = Analysis::join(exit, left);
+
+            Analysis::assume_nonzero(body);
+            Analysis::State next = Analysis::join(head, body);
+            if (iteration >= Analysis::WIDEN_AFTER) {
+                next = Analysis::widen(head, next);
+            }
+            if (next == head) {
+                break;
+            }
+            head = next;
+        }
+
+        Analysis::Loops[this] = { entry, exit };
+        state = exit;
+    }
+
+    void codegen() override {
+        BasicBlock *base_block = Builder->GetInsertBlock();
+        Function *TheFunction = base_block->getParent();
+
+        // Checks the analysis found to always go the same way are left out
+        unsigned entry_outcomes = Analysis::outcomes(Analysis::Entries, this);
+        unsigned latch_outcomes = Analysis::outcomes(Analysis::Latches, this);
+        if (!(entry_outcomes & Analysis::NONZERO)) {
+            return;
+        }
+        BoundsCheck::SourceOffset = source_offset;
+
+        // The outermost loop of a balanced loop nest keeps the cells
+        // the nest accesses in registers while it runs
+        std::map<int64_t, bool> accessed;
+        int64_t offset = 0;
+        bool balanced = collect_accessed_cells(offset, accessed);
+
+        // The cells that only nested loops get to may be off the tape
+        // when those loops don't run, unless they are known not to be
+        bool on_tape = balanced
+            && (touches_range(accessed)
+                || BoundsCheck::proven(this, accessed.begin()->first, accessed.rbegin()->first)
+                || (!BoundsCheck::enabled()
+                    && TapeLayout::within_margin(std::max(-accessed.begin()->first, accessed.rbegin()->first))));
+        bool promote = PromoteCells
+            && !CellPromotion::Active
+            && on_tape
+            && accessed.size() <= CellPromotion::MAX_CELLS;
+
+        // A balanced loop nest accesses the same cells on every iteration,
+        // they are all checked once it is entered. Other loops check the
+        // cell they start on here and their body as it runs.
+        bool check_entry = BoundsCheck::enabled() && !BoundsCheck::proven(this, 0, 0);
+        bool covers_nest = BoundsCheck::enabled() && on_tape;
+        bool check_nest = covers_nest
+            && !BoundsCheck::proven(this, accessed.begin()->first, accessed.rbegin()->first);
+        if (check_entry) {
+            BoundsCheck::emit(0, 0);
+        }
+
+        GlobalVariable *counters = nullptr;
+        if (LoopProfile::enabled()) {
+            counters = LoopProfile::create_counters(source_offset);
+            LoopProfile::increment_counter(counters, LoopProfile::REACHED);
+        }
+
+        BasicBlock *group_content = BasicBlock::Create(*TheContext, "group content", TheFunction);
+        BasicBlock *merge = BasicBlock::Create(*TheContext, "merge", TheFunction);
+
+        // When profiling or promoting cells, the edges into and out of
+        // the loop get blocks of their own, so that we can count how often
+        // they are taken and load and store the promoted cells there
+        BasicBlock *preheader = group_content;
+        BasicBlock *exit = merge;
+        if (counters || promote || check_nest) {
+            preheader = BasicBlock::Create(*TheContext, "group preheader", TheFunction, group_content);
+            exit = BasicBlock::Create(*TheContext, "group exit", TheFunction, merge);
+        }
+
+        RegisterState entry_state = RegisterState::current();
+        BasicBlock *entry_block = Builder->GetInsertBlock();
+        BranchInst *entry_branch;
+        if (entry_outcomes & Analysis::ZERO) {
+            // Entry Condition:
+            // Check if the current tape cell is zero, if so,
+            // jump past the end of the group
+            Value* start_condition = Builder->CreateICmpNE(
+                load_current_cell(),
+                ConstantInt::get(Type::getInt8Ty(*TheContext), 0)
+            );
+            entry_branch = Builder->CreateCondBr(start_condition, preheader, merge);
+        } else {
+            entry_branch = Builder->CreateBr(preheader);
+        }
+
+        Value *start_cycles = nullptr;
+        if (preheader != group_content) {
+            Builder->SetInsertPoint(preheader);
+            if (counters) {
+                LoopProfile::increment_counter(counters, LoopProfile::ENTERED);
+                if (ProfileCycles) {
+                    start_cycles = LoopProfile::read_cycle_counter();
+                }
+            }
+            if (check_nest) {
+                BoundsCheck::emit(accessed.begin()->first, accessed.rbegin()->first);
+            }
+            if (promote) {
+                CellPromotion::begin(accessed);
+            }
+        }
+        RegisterState preheader_state = RegisterState::current();
+        BasicBlock *preheader_end = Builder->GetInsertBlock();
+        if (preheader != group_content) {
+            Builder->CreateBr(group_content);
+        }
+
+        // If the value is not zero, we simply emit all the child IR.
+        // The position and promoted cells at the start of the group are
+        // either the ones we entered with or the ones at the end of the
+        // previous iteration.
+        Builder->SetInsertPoint(group_content);
+        RegisterState header_state = RegisterState::create_phis(preheader_state);
+        header_state.add_incoming(preheader_state, preheader_end);
+        header_state.restore();
+
+        if (counters) {
+            LoopProfile::increment_counter(counters, LoopProfile::ITERATIONS);
+        }
+
+        bool was_covered = BoundsCheck::Covered;
+        BoundsCheck::Covered |= covers_nest;
+        codegen_children(true);
+        BoundsCheck::Covered = was_covered;
+
+        // At the end of the is not zero block, chekc if the current
+        // cell is zero, in which case jump back to the start of the group
+        RegisterState latch_state = RegisterState::current();
+        BasicBlock *latch_block = Builder->GetInsertBlock();
+        if (!(latch_outcomes & Analysis::NONZERO)) {
+            // The body always ends on a zero cell, it runs at most once
+            Builder->CreateBr(exit);
+        } else {
+            Value* end_condition = Builder->CreateICmpNE(
+                load_current_cell(),
+                ConstantInt::get(Type::getInt8Ty(*TheContext), 0)
+            );
+
+            // Explicitly fallthrough out of the if branch
+            BranchInst *latch_branch = Builder->CreateCondBr(end_condition, group_content, exit);
+            header_state.add_incoming(latch_state, latch_block);
+
+            bool innermost = llvm::none_of(children, [](Node *child) {
+                return isa<ConditionalGroupNode>(child);
+            });
+            if (const LoopProfile::Counts *recorded = LoopProfile::lookup(source_offset)) {
+                LoopProfile::annotate_loop(entry_branch, latch_branch, *recorded, innermost);
+            } else if (innermost && balanced && none_of(children, [](Node *child) {
+                return isa<PutCharNode>(child) || isa<GetCharNode>(child);
+            })) {
+                // Without I/O, an innermost balanced loop only does
+                // arithmetic on a fixed set of cells, ask LLVM to vectorize it
+                latch_branch->setMetadata(LLVMContext::MD_loop, LoopProfile::loop_hints({
+                    MDNode::get(*TheContext, {
+                        MDString::get(*TheContext, "llvm.loop.vectorize.enable"),
+                        ConstantAsMetadata::get(ConstantInt::getTrue(*TheContext))
+                    })
+                }));
+            }
+        }
+
+        if (exit != merge) {
+            Builder->SetInsertPoint(exit);
+            if (start_cycles) {
+                Value *cycles = Builder->CreateSub(LoopProfile::read_cycle_counter(), start_cycles, "loop cycles");
+                LoopProfile::add_to_counter(counters, LoopProfile::CYCLES, cycles);
+            }
+            if (promote) {
+                CellPromotion::end();
+            }
+            Builder->CreateBr(merge);
+        }
+
+        // The merge block simply falls through back into the base block
+        Builder->SetInsertPoint(merge);
+        RegisterState merge_state = RegisterState::create_phis(entry_state);
+        if (entry_branch->isConditional()) {
+            merge_state.add_incoming(entry_state, entry_block);
+        }
+        merge_state.add_incoming(latch_state, exit != merge ? exit : latch_block);
+        merge_state.restore();
+    }
+};
+
+static void print_move(std::ostream &out, int64_t step) {
+    out << (step > 0 ? '>' : '<');
+}
+
+// Moves `count` cells, left if it's negative
+static void print_moves(std::ostream &out, int64_t count) {
+    for (int64_t i = 0; i < std::abs(count); i++) {
+        print_move(out, count);
+    }
+}
+
+// Adds `amount` to the cell `offset` cells away, in fewer than 128 steps
+static void print_add(std::ostream &out, int64_t offset, uint8_t amount) {
+    print_moves(out, offset);
+    if (amount < 128) {
+        out << std::string(amount, '+');
+    } else {
+        out << std::string(256 - amount, '-');
+    }
+    print_moves(out, -offset);
+}
+
+// The nodes below come out of the e-graph optimizer.
+// Offsets are relative to the current position.
+
+// c[offset] += amount
+class AddNode: public Node {
+    int64_t offset;
+    uint8_t amount;
+
+public:
+    AddNode(int64_t offset, uint8_t amount): Node(NK_Add), offset(offset), amount(amount) {};
+
+    static bool classof(const Node *node) {
+        return node->getKind() == NK_Add;
+    }
+
+    int64_t get_offset() const {
+        return offset;
+    }
+
+    uint8_t get_amount() const {
+        return amount;
+    }
+
+    void debug_print(std::ostream &out) override {
+        print_add(out, offset, amount);
+    }
+
+    bool collect_accessed_cells(int64_t &current, std::map<int64_t, bool> &cells) override {
+        cells[current + offset] = true;
+        return true;
+    }
+
+    bool execute_symbolically(ClosedForm::State &state) override {
+        int64_t cell = state.offset + offset;
+        return state.set(cell, ClosedForm::add(state.get(cell), ClosedForm::constant(amount)));
+    }
+
+    void analyze(Analysis::State &state) override {
+        state.set(offset, Analysis::add(state.get(offset), Analysis::Range::constant(amount)));
+    }
+
+    unsigned add_to_egraph(EGraph::Graph &graph, unsigned rest) override {
+        return graph.add_folded(EGraph::make(EGraph::ADD, offset, 0, amount, { rest }));
+    }
+
+    void codegen() override {
+        Value *to_add = ConstantInt::get(Type::getInt8Ty(*TheContext), amount);
+        store_cell(offset, Builder->CreateAdd(load_cell(offset), to_add, "new tape value"));
+    }
+};
+
+// c[offset] = value
+class SetNode: public Node {
+    int64_t offset;
+    uint8_t value;
+
+public:
+    SetNode(int64_t offset, uint8_t value): Node(NK_Set), offset(offset), value(value) {};
+
+    static bool classof(const Node *node) {
+        return node->getKind() == NK_Set;
+    }
+
+    int64_t get_offset() const {
+        return offset;
+    }
+
+    uint8_t get_value() const {
+        return value;
+    }
+
+    void debug_print(std::ostream &out) override {
+        print_moves(out, offset);
+        out << "[-]";
+        print_moves(out, -offset);
+        print_add(out, offset, value);
+    }
+
+    bool collect_accessed_cells(int64_t &current, std::map<int64_t, bool> &cells) override {
+        cells[current + offset] = true;
+        return true;
+    }
+
+    bool execute_symbolically(ClosedForm::State &state) override {
+        return state.set(state.offset + offset, ClosedForm::constant(value));
+    }
+
+    void analyze(Analysis::State &state) override {
+        state.set(offset, Analysis::Range::constant(value));
+    }
+
+    unsigned add_to_egraph(EGraph::Graph &graph, unsigned rest) override {
+        return graph.add(EGraph::make(EGraph::SET, offset, 0, value, { rest }));
+    }
+
+    void codegen() override {
+        store_cell(offset, ConstantInt::get(Type::getInt8Ty(*TheContext), value));
+    }
+};
+
+// position += amount
+class MoveNode: public Node {
+    int64_t amount;
+
+public:
+    explicit MoveNode(int64_t amount): Node(NK_Move), amount(amount) {};
+
+    static bool classof(const Node *node) {
+        return node->getKind() == NK_Move;
+    }
+
+    int64_t get_amount() const {
+        return amount;
+    }
+
+    void debug_print(std::ostream &out) override {
+        print_moves(out, amount);
+    }
+
+    bool collect_accessed_cells(int64_t &current, std::map<int64_t, bool> &cells) override {
+        current += amount;
+        return true;
+    }
+
+    bool execute_symbolically(ClosedForm::State &state) override {
+        state.offset += amount;
+        return true;
+    }
+
+    void analyze(Analysis::State &state) override {
+        state.move(amount);
+    }
+
+    unsigned add_to_egraph(EGraph::Graph &graph, unsigned rest) override {
+        return graph.add_folded(EGraph::make(EGraph::MOVE, amount, 0, 0, { rest }));
+    }
+
+    void codegen() override {
+        move_position(amount);
+    }
+};
+
+// c[offset] += c[source] * factor
+class MultiplyAddNode: public Node {
+    int64_t offset;
+    int64_t source;
+    uint8_t factor;
+
+public:
+    MultiplyAddNode(int64_t offset, int64_t source, uint8_t factor):
+        Node(NK_MultiplyAdd), offset(offset), source(source), factor(factor) {};
+
+    static bool classof(const Node *node) {
+        return node->getKind() == NK_MultiplyAdd;
+    }
+
+    int64_t get_offset() const {
+        return offset;
+    }
+
+    int64_t get_source() const {
+        return source;
+    }
+
+    uint8_t get_factor() const {
+        return factor;
+    }
+
+    // There is no loop-free Brainfuck for this
+    void debug_print(std::ostream &out) override {
+        out << "{c" << offset << " += c" << source << " * " << (unsigned)factor << "}";
+    }
+
+    bool collect_accessed_cells(int64_t &current, std::map<int64_t, bool> &cells) override {
+        cells[current + source];
+        cells[current + offset] = true;
+        return true;
+    }
+
+    bool execute_symbolically(ClosedForm::State &state) override {
+        int64_t cell = state.offset + offset;
+        ClosedForm::Polynomial product = ClosedForm::multiply(
+            state.get(state.offset + source),
+            ClosedForm::constant(factor)
+        );
+        return state.set(cell, ClosedForm::add(state.get(cell), product));
+    }
+
+    void analyze(Analysis::State &state) override {
+        Analysis::Range product = Analysis::multiply(state.get(source), Analysis::Range::constant(factor));
+        state.set(offset, Analysis::add(state.get(offset), product));
+    }
+
+    unsigned add_to_egraph(EGraph::Graph &graph, unsigned rest) override {
+        return graph.add(EGraph::make(EGraph::MUL_ADD, offset, source, factor, { rest }));
+    }
+
+    void codegen() override {
+        if (BoundsCheck::enabled() && !BoundsCheck::proven(this, source, source)) {
+            BoundsCheck::emit(source, source);
+        }
+        Value *multiplier = load_cell(source);
+        auto multiply_add = [&]() {
+            Value *product = Builder->CreateMul(
+                multiplier,
+                ConstantInt::get(Type::getInt8Ty(*TheContext), factor),
+                "product"
+            );
+            store_cell(offset, Builder->CreateAdd(load_cell(offset), product, "new tape value"));
+        };
+
+        // The loop this comes from only reached c[offset] if c[source]
+        // wasn't zero, it need not be on the tape otherwise. Without
+        // bounds checks, a cell in the tape's margin is fine too.
+        if (CellPromotion::Active
+            || BoundsCheck::proven_from(this, source, offset)
+            || (!BoundsCheck::enabled() && TapeLayout::within_margin(offset - source))) {
+            multiply_add();
+            return;
+        }
+        Value *nonzero = Builder->CreateICmpNE(
+            multiplier,
+            ConstantInt::get(Type::getInt8Ty(*TheContext), 0),
+            "multiplier nonzero"
+        );
+        emit_if(nonzero, "multiply add", [&]() {
+            if (BoundsCheck::enabled()) {
+                BoundsCheck::emit(offset, offset);
+            }
+            multiply_add();
+        });
+    }
+};
+
+// [-]>[-]>[-]
+// Clears `count` cells `step` apart, ending on the last one
+class ClearRangeNode: public Node {
+    size_t count;
+    int64_t step;
+
+public:
+    ClearRangeNode(size_t count, int64_t step): Node(NK_ClearRange), count(count), step(step) {};
+
+    static bool classof(const Node *node) {
+        return node->getKind() == NK_ClearRange;
+    }
+
+    size_t get_count() const {
+        return count;
+    }
+
+    int64_t get_step() const {
+        return step;
+    }
+
+    void debug_print(std::ostream &out) override {
+        for (size_t i = 0; i < count; i++) {
+            if (i > 0) {
+                print_move(out, step);
+            }
+            out << "[-]";
+        }
+    }
+
+    bool collect_accessed_cells(int64_t &offset, std::map<int64_t, bool> &cells) override {
+        for (size_t i = 0; i < count; i++) {
+            cells[offset + (int64_t)i * step] = true;
+        }
+        offset += (int64_t)(count - 1) * step;
+        return true;
+    }
+
+    bool execute_symbolically(ClosedForm::State &state) override {
+        for (size_t i = 0; i < count; i++) {
+            state.set(state.offset + (int64_t)i * step, ClosedForm::constant(0));
+        }
+        state.offset += (int64_t)(count - 1) * step;
+        return true;
+    }
+
+    void analyze(Analysis::State &state) override {
+        for (size_t i = 0; i < count; i++) {
+            state.set((int64_t)i * step, Analysis::Range::constant(0));
+        }
+        state.move((int64_t)(count - 1) * step);
+    }
+
+    void codegen() override {
+        Value *zero = ConstantInt::get(Type::getInt8Ty(*TheContext), 0);
+        int64_t last = (int64_t)(count - 1) * step;
+
+        if (CellPromotion::Active) {
+            for (size_t i = 0; i < count; i++) {
+                store_cell((int64_t)i * step, zero);
+            }
+        } else {
+            Builder->CreateMemSet(
+                get_relative_cell_ptr(std::min((int64_t)0, last)),
+                zero,
+                count,
+                MaybeAlign(1),
+                false,
+                TapeMetadata::TBAATag,
+                TapeMetadata::Scope
+            );
+        }
+
+        move_position(last);
+    }
+};
+
+// [->+<]>[->+<] or >[-<+>]>[-<+>]
+// Adds each of `count` cells `step` apart to its neighbour at `target`
+// and clears it, ending on the last one. When the neighbour is the next
+// cell in the chain, the values accumulate into the cell past the end.
+// Otherwise the cells shift by one, the first being added to the cell
+// before the chain.
+class TransferChainNode: public Node {
+    size_t count;
+    int64_t step;
+    int64_t target;
+
+public:
+    TransferChainNode(size_t count, int64_t step, int64_t target):
+        Node(NK_TransferChain), count(count), step(step), target(target) {};
+
+    static bool classof(const Node *node) {
+        return node->getKind() == NK_TransferChain;
+    }
+
+    size_t get_count() const {
+        return count;
+    }
+
+    int64_t get_step() const {
+        return step;
+    }
+
+    int64_t get_target() const {
+        return target;
+    }
+
+    void debug_print(std::ostream &out) override {
+        for (size_t i = 0; i < count; i++) {
+            if (i > 0) {
+                print_move(out, step);
+            }
+            out << "[-";
+            print_move(out, target);
+            out << "+";
+            print_move(out, -target);
+            out << "]";
+        }
+    }
+
+    bool collect_accessed_cells(int64_t &offset, std::map<int64_t, bool> &cells) override {
+        for (size_t i = 0; i < count; i++) {
+            cells[offset + (int64_t)i * step] = true;
+            cells[offset + (int64_t)i * step + target] = true;
+        }
+        offset += (int64_t)(count - 1) * step;
+        return true;
+    }
+
+    bool execute_symbolically(ClosedForm::State &state) override {
+        for (size_t i = 0; i < count; i++) {
+            int64_t cell = state.offset + (int64_t)i * step;
+            if (!state.set(cell + target, ClosedForm::add(state.get(cell + target), state.get(cell)))) {
+                return false;
+            }
+            state.set(cell, ClosedForm::constant(0));
+        }
+        state.offset += (int64_t)(count - 1) * step;
+        return true;
+    }
+
+    void analyze(Analysis::State &state) override {
+        for (size_t i = 0; i < count; i++) {
+            int64_t cell = (int64_t)i * step;
+            state.set(cell + target, Analysis::add(state.get(cell + target), state.get(cell)));
+            state.set(cell, Analysis::Range::constant(0));
+        }
+        state.move((int64_t)(count - 1) * step);
+    }
+
+    // Add `value` to the cell just outside the range. The loops only get
+    // to that cell if `value` isn't zero, it need not be on the tape otherwise.
+    void add_outside(int64_t inside, int64_t outside, Value *value) {
+        auto add = [&]() {
+            store_cell(outside, Builder->CreateAdd(load_cell(outside), value, "transferred"));
+        };
+        if (BoundsCheck::proven_from(this, inside, outside)
+            || (!BoundsCheck::enabled() && TapeLayout::within_margin(outside - inside))) {
+            add();
+            return;
+        }
+        Value *nonzero = Builder->CreateICmpNE(value, ConstantInt::get(Type::getInt8Ty(*TheContext), 0), "transfer");
+        emit_if(nonzero, "transfer", [&]() {
+            if (BoundsCheck::enabled()) {
+                BoundsCheck::emit(outside, outside);
+            }
+            add();
+        });
+    }
+
+    void codegen() override {
+        Value *zero = ConstantInt::get(Type::getInt8Ty(*TheContext), 0);
+        int64_t last = (int64_t)(count - 1) * step;
+        int64_t low = std::min((int64_t)0, last);
+        int64_t high = std::max((int64_t)0, last);
+        if (BoundsCheck::enabled() && !BoundsCheck::proven(this, low, high)) {
+            BoundsCheck::emit(low, high);
+        }
+
+        if (CellPromotion::Active) {
+            // Promoted cells are registers, just do what the loops do
+            for (size_t i = 0; i < count; i++) {
+                int64_t cell = (int64_t)i * step;
+                Value *sum = Builder->CreateAdd(load_cell(cell + target), load_cell(cell), "transferred");
+                store_cell(cell + target, sum);
+                store_cell(cell, zero);
+            }
+        } else if (target == step) {
+            // Sum up the whole range at once and clear it
+            Type *range_type = FixedVectorType::get(Type::getInt8Ty(*TheContext), count);
+            Value *range_ptr = Builder->CreateBitCast(
+                get_relative_cell_ptr(std::min((int64_t)0, last)),
+                range_type->getPointerTo(),
+                "range ptr"
+            );
+            Value *range = TapeMetadata::annotate_access(
+                Builder->CreateAlignedLoad(range_type, range_ptr, MaybeAlign(1), "range")
+            );
+            add_outside(last, last + target, Builder->CreateAddReduce(range));
+            Builder->CreateMemSet(
+                get_relative_cell_ptr(std::min((int64_t)0, last)),
+                zero,
+                count,
+                MaybeAlign(1),
+                false,
+                TapeMetadata::TBAATag,
+                TapeMetadata::Scope
+            );
+        } else {
+            // The first cell is added to its neighbour outside the range,
+            // the others move over by one
+            add_outside(0, target, load_cell(0));
+            int64_t destination = std::min((int64_t)0, last - step);
+            Builder->CreateMemMove(
+                get_relative_cell_ptr(destination),
+                MaybeAlign(1),
+                get_relative_cell_ptr(destination + step),
+                MaybeAlign(1),
+                count - 1,
+                false,
+                TapeMetadata::TBAATag,
+                nullptr,
+                TapeMetadata::Scope
+            );
+            store_cell(last, zero);
+        }
+
+        move_position(last);
+    }
+};
+
+// A loop replaced by the polynomials it computes
+class ClosedFormLoopNode: public Node {
+    ClosedForm::LoopEffect effect;
+    Node *loop;
+
+public:
+    ClosedFormLoopNode(ClosedForm::LoopEffect effect, Node *loop):
+        Node(NK_ClosedFormLoop), effect(std::move(effect)), loop(loop) {};
+
+    static bool classof(const Node *node) {
+        return node->getKind() == NK_ClosedFormLoop;
+    }
+
+    // The loop this replaces
+    Node* get_loop() const {
+        return loop;
+    }
+
+    void debug_print(std::ostream &out) override {
+        loop->debug_print(out);
+    }
+
+    bool collect_accessed_cells(int64_t &offset, std::map<int64_t, bool> &cells) override {
+        cells[offset];
+        for (auto &value: effect.values) {
+            cells[offset + value.first] = true;
+            for (auto &term: value.second) {
+                for (int64_t cell: term.first) {
+                    cells[offset + cell];
+                }
+            }
+        }
+        return true;
+    }
+
+    bool execute_symbolically(ClosedForm::State &state) override {
+        return ClosedForm::apply(effect, state);
+    }
+
+    // Whether every iteration of the loop gets to the cells the closed
+    // form accesses, or to cells on either side of them
+    bool touched_when_entered() {
+        std::map<int64_t, bool> accessed;
+        int64_t offset = 0;
+        collect_accessed_cells(offset, accessed);
+        return cast<ConditionalGroupNode>(loop)->touches_range(accessed);
+    }
+
+    void analyze(Analysis::State &state) override {
+        Analysis::Range counter = state.get(0);
+        Analysis::record(Analysis::Entries, this, Analysis::outcomes_of(counter));
+        if (!counter.may_be_nonzero()) {
+            return;
+        }
+        if (BoundsChecks || !touched_when_entered()) {
+            // The loop itself may be emitted instead
+            Analysis::State copy = state;
+            Analysis::visit(loop, state.position);
+            loop->analyze(copy);
+        }
+
+        std::map<int64_t, Analysis::Range> results;
+        for (auto &value: effect.values) {
+            Analysis::Range result = Analysis::evaluate(value.second, [&](int64_t cell) {
+                return state.get(cell);
+            });
+            if (effect.guarded && counter.may_be_zero()) {
+                result = Analysis::join(result, state.get(value.first));
+            }
+            results[value.first] = result;
+        }
+        for (auto &result: results) {
+            state.set(result.first, result.second);
+        }
+    }
+
+    void codegen() override {
+        // Never entered, the loop does nothing
+        unsigned entry_outcomes = Analysis::outcomes(Analysis::Entries, this);
+        if (!(entry_outcomes & Analysis::NONZERO)) {
+            return;
+        }
+
+        // The closed form reads all its cells even when the loop wouldn't
+        // run, unless they are known to be on the tape the loop has to
+        // check them itself
+        std::map<int64_t, bool> accessed;
+        int64_t offset = 0;
+        collect_accessed_cells(offset, accessed);
+        int64_t low = accessed.begin()->first;
+        int64_t high = accessed.rbegin()->first;
+        bool proven = BoundsCheck::proven(this, low, high);
+        if (BoundsCheck::enabled() && !proven) {
+            loop->codegen();
+            return;
+        }
+
+        // Otherwise it only touches them once the loop is entered, which
+        // is as late as the loop gets to them if its body does so on every
+        // iteration. Cells that only some iterations get to may be off the
+        // tape, the loop itself only touches them when they are not.
+        bool may_skip = entry_outcomes & Analysis::ZERO;
+        bool in_margin = TapeLayout::within_margin(std::max(-low, high));
+        if (!proven && !CellPromotion::Active && !in_margin && !touched_when_entered()) {
+            loop->codegen();
+            return;
+        }
+        if (may_skip && !proven && !CellPromotion::Active && !in_margin) {
+            Value *entered = Builder->CreateICmpNE(
+                load_current_cell(),
+                ConstantInt::get(Type::getInt8Ty(*TheContext), 0),
+                "entered"
+            );
+            emit_if(entered, "closed form", [&]() {
+                apply(false);
+            });
+            return;
+        }
+        apply(effect.guarded && may_skip);
+    }
+
+    // Store the closed form's results. With `guarded`, cells
+    // keep their values unless the loop would be entered.
+    void apply(bool guarded) {
+        // Load every cell the loop reads or writes
+        std::map<int64_t, Value *> initial;
+        auto load = [&](int64_t cell) {
+            if (!initial.count(cell)) {
+                initial[cell] = load_cell(cell);
+            }
+        };
+        load(0);
+        for (auto &value: effect.values) {
+            load(value.first);
+            for (auto &term: value.second) {
+                for (int64_t cell: term.first) {
+                    load(cell);
+                }
+            }
+        }
+
+        // A guarded closed form only applies if the loop would be entered
+        Value *entered = nullptr;
+        if (guarded) {
+            entered = Builder->CreateICmpNE(
+                initial[0],
+                ConstantInt::get(Type::getInt8Ty(*TheContext), 0),
+                "entered"
+            );
+        }
+
+        std::map<int64_t, Value *> results;
+        for (auto &value: effect.values) {
+            Value *result = ClosedForm::evaluate(value.second, initial);
+            if (entered) {
+                result = Builder->CreateSelect(entered, result, initial[value.first]);
+            }
+            results[value.first] = result;
+        }
+        for (auto &result: results) {
+            store_cell(result.first, result.second);
+        }
+    }
+};
+
+// A divmod idiom, computed with a division when the cells it works
+// on have the layout it expects, and by the original loop otherwise
+class DivModNode: public Node {
+    const Idioms::DivMod &idiom;
+    int64_t direction;
+    Node *loop;
+
+public:
+    DivModNode(const Idioms::DivMod &idiom, int64_t direction, Node *loop):
+        Node(NK_DivMod), idiom(idiom), direction(direction), loop(loop) {};
+
+    static bool classof(const Node *node) {
+        return node->getKind() == NK_DivMod;
+    }
+
+    // The loop this replaces
+    Node* get_loop() const {
+        return loop;
+    }
+
+    void debug_print(std::ostream &out) override {
+        loop->debug_print(out);
+    }
+
+    bool collect_accessed_cells(int64_t &offset, std::map<int64_t, bool> &cells) override {
+        return loop->collect_accessed_cells(offset, cells);
+    }
+
+    void analyze(Analysis::State &state) override {
+        Analysis::Range dividend = state.get(0);
+        Analysis::Range divisor = state.get(idiom.divisor * direction);
+        bool may_match = divisor.high >= idiom.min_divisor;
+        bool may_not_match = divisor.low < idiom.min_divisor;
+        for (int64_t cell: idiom.zero_cells) {
+            Analysis::Range value = state.get(cell * direction);
+            may_match = may_match && value.may_be_zero();
+            may_not_match = may_not_match || value.may_be_nonzero();
+        }
+        Analysis::record(Analysis::Entries, this,
+            (may_match ? Analysis::NONZERO : 0) | (may_not_match ? Analysis::ZERO : 0));
+
+        Analysis::State divided = state;
+        divided.reachable = may_match;
+        if (may_match) {
+            bool exact = dividend.is_constant() && divisor.is_constant();
+            uint8_t highest_divisor = divisor.high;
+            uint8_t lowest_divisor = std::max(divisor.low, (uint8_t)idiom.min_divisor);
+            for (auto &result: idiom.results) {
+                Analysis::Range value = Analysis::Range::unknown();
+                switch (result.second) {
+                    case Idioms::ZERO:
+                        value = Analysis::Range::constant(0);
+                        break;
+                    case Idioms::DIVIDEND:
+                        value = dividend;
+                        break;
+                    case Idioms::DIVISOR_MINUS_REMAINDER:
+                        value = exact
+                            ? Analysis::Range::constant(divisor.low - dividend.low % divisor.low)
+                            : Analysis::Range{ 1, highest_divisor };
+                        break;
+                    case Idioms::REMAINDER:
+                        value = exact
+                            ? Analysis::Range::constant(dividend.low % divisor.low)
+                            : Analysis::Range{ 0, (uint8_t)(highest_divisor - 1) };
+                        break;
+                    case Idioms::QUOTIENT:
+                        value = exact
+                            ? Analysis::Range::constant(dividend.low / divisor.low)
+                            : Analysis::Range{ 0, (uint8_t)(dividend.high / lowest_divisor) };
+                        break;
+                }
+                divided.set(result.first * direction, value);
+            }
+        }
+
+        Analysis::State fallback = state;
+        fallback.reachable = may_not_match;
+        Analysis::visit(loop, state.position);
+        if (may_not_match) {
+            loop->analyze(fallback);
+        } else if (BoundsChecks) {
+            // The loop may be emitted on its own instead
+            Analysis::State copy = state;
+            loop->analyze(copy);
+        }
+        state = Analysis::join(divided, fallback);
+    }
+
+    // Store the results of dividing the current cell by the divisor
+    void divide() {
+        Type *cell_type = Type::getInt8Ty(*TheContext);
+        Value *dividend = load_current_cell();
+        Value *divisor = load_cell(idiom.divisor * direction);
+        Value *quotient = Builder->CreateUDiv(dividend, divisor, "quotient");
+        Value *remainder = Builder->CreateURem(dividend, divisor, "remainder");
+        for (auto &result: idiom.results) {
+            Value *value = nullptr;
+            switch (result.second) {
+                case Idioms::ZERO:
+                    value = ConstantInt::get(cell_type, 0);
+                    break;
+                case Idioms::DIVIDEND:
+                    value = dividend;
+                    break;
+                case Idioms::DIVISOR_MINUS_REMAINDER:
+                    value = Builder->CreateSub(divisor, remainder);
+                    break;
+                case Idioms::REMAINDER:
+                    value = remainder;
+                    break;
+                case Idioms::QUOTIENT:
+                    value = quotient;
+                    break;
+            }
+            store_cell(result.first * direction, value);
+        }
+    }
+
+    void codegen() override {
+        std::vector<int64_t> cells = idiom.zero_cells;
+        cells.push_back(0);
+        cells.push_back(idiom.divisor);
+        for (auto &result: idiom.results) {
+            cells.push_back(result.first);
+        }
+        auto range = std::minmax_element(cells.begin(), cells.end());
+        int64_t low = std::min(*range.first * direction, *range.second * direction);
+        int64_t high = std::max(*range.first * direction, *range.second * direction);
+        bool proven = BoundsCheck::proven(this, low, high);
+
+        // Without knowing that the cells the idiom works on are on the
+        // tape, leave it to the loop to check the ones it accesses
+        if (BoundsCheck::enabled() && !proven) {
+            loop->codegen();
+            return;
+        }
+
+        // Like the loop, only look at the other cells if the dividend
+        // isn't zero, they need not be on the tape otherwise
+        if (proven || TapeLayout::within_margin(std::max(-low, high))) {
+            codegen_entered();
+            return;
+        }
+        Value *nonzero = Builder->CreateICmpNE(
+            load_current_cell(),
+            ConstantInt::get(Type::getInt8Ty(*TheContext), 0),
+            "dividend nonzero"
+        );
+        emit_if(nonzero, idiom.name, [&]() {
+            codegen_entered();
+        });
+    }
+
+    // The idiom once the dividend isn't zero
+    void codegen_entered() {
+        // Leave out whichever way the analysis found the guard never goes
+        unsigned guard = Analysis::outcomes(Analysis::Entries, this);
+        if (!(guard & Analysis::ZERO)) {
+            divide();
+            return;
+        }
+        if (!(guard & Analysis::NONZERO)) {
+            loop->codegen();
+            return;
+        }
+
+        Function *TheFunction = Builder->GetInsertBlock()->getParent();
+        Type *cell_type = Type::getInt8Ty(*TheContext);
+
+        Value *expected_layout = Builder->CreateICmpUGE(
+            load_cell(idiom.divisor * direction),
+            ConstantInt::get(cell_type, idiom.min_divisor),
+            "divisor in range"
+        );
+        for (int64_t cell: idiom.zero_cells) {
+            Value *is_zero = Builder->CreateICmpEQ(load_cell(cell * direction), ConstantInt::get(cell_type, 0));
+            expected_layout = Builder->CreateAnd(expected_layout, is_zero, "expected layout");
+        }
+
+        BasicBlock *divide_block = BasicBlock::Create(*TheContext, idiom.name, TheFunction);
+        BasicBlock *fallback = BasicBlock::Create(*TheContext, "idiom fallback", TheFunction);
+        BasicBlock *merge = BasicBlock::Create(*TheContext, "idiom merge", TheFunction);
+
+        RegisterState entry_state = RegisterState::current();
+        Builder->CreateCondBr(expected_layout, divide_block, fallback);
+
+        Builder->SetInsertPoint(divide_block);
+        divide();
+        RegisterState divide_state = RegisterState::current();
+        BasicBlock *divide_end = Builder->GetInsertBlock();
+        Builder->CreateBr(merge);
+
+        Builder->SetInsertPoint(fallback);
+        entry_state.restore();
+        loop->codegen();
+        RegisterState fallback_state = RegisterState::current();
+        BasicBlock *fallback_end = Builder->GetInsertBlock();
+        Builder->CreateBr(merge);
+
+        Builder->SetInsertPoint(merge);
+        RegisterState merge_state = RegisterState::create_phis(entry_state);
+        merge_state.add_incoming(divide_state, divide_end);
+        merge_state.add_incoming(fallback_state, fallback_end);
+        merge_state.restore();
+    }
+};
+}
+
+namespace AstPasses {
+
+// Returns the single step of a move node, or 0 for any other node
+static int64_t move_step(Ast::Node *node) {
+    if (isa<Ast::MoveRightNode>(node)) {
+        return 1;
+    }
+    if (isa<Ast::MoveLeftNode>(node)) {
+        return -1;
+    }
+    return 0;
+}
+
+// [-] or [+]
+static bool is_clear_loop(Ast::Node *node) {
+    auto *loop = dyn_cast<Ast::ConditionalGroupNode>(node);
+    if (!loop || loop->get_children().size() != 1) {
+        return false;
+    }
+    Ast::Node *body = loop->get_children()[0];
+    return isa<Ast::DecrementNode>(body) || isa<Ast::IncrementNode>(body);
+}
+
+// [->+<], [>+<-] and their mirror images. Returns the
+// offset of the cell the loop adds to, or 0 if it isn't one.
+static int64_t transfer_loop_target(Ast::Node *node) {
+    auto *loop = dyn_cast<Ast::ConditionalGroupNode>(node);
+    if (!loop || loop->get_children().size() != 4) {
+        return 0;
+    }
+    auto &body = loop->get_children();
+    size_t first = isa<Ast::DecrementNode>(body[0]) ? 1 : 0;
+    if (first == 0 && !isa<Ast::DecrementNode>(body[3])) {
+        return 0;
+    }
+    int64_t target = move_step(body[first]);
+    if (target == 0
+        || !isa<Ast::IncrementNode>(body[first + 1])
+        || move_step(body[first + 2]) != -target) {
+        return 0;
+    }
+    return target;
+}
+
+// Replace runs of at least two loops matching `matches`, each a single
+// move apart, with the node `create` returns for the run
+template <typename Matches, typename Create>
+static void replace_chains(std::vector<Ast::Node *> &children, Matches matches, Create create) {
+    std::vector<Ast::Node *> result;
+    for (size_t i = 0; i < children.size(); i++) {
+        int64_t step = 0;
+        size_t count = 1;
+        if (matches(children[i], children[i]) && i + 2 < children.size()) {
+            step = move_step(children[i + 1]);
+            while (step != 0
+                && i + 2 * count < children.size()
+                && move_step(children[i + 2 * count - 1]) == step
+                && matches(children[i], children[i + 2 * count])) {
+                count++;
+            }
+        }
+
+        if (count < 2) {
+            result.push_back(children[i]);
+            continue;
+        }
+        result.push_back(create(children[i], count, step));
+        i += 2 * (count - 1);
+    }
+    children = std::move(result);
+}
+
+static void clear_ranges(std::vector<Ast::Node *> &children) {
+    replace_chains(children,
+        [](Ast::Node *, Ast::Node *node) {
+            return is_clear_loop(node);
+        },
+        [](Ast::Node *, size_t count, int64_t step) {
+            return new Ast::ClearRangeNode(count, step);
+        });
+}
+
+static void transfer_chains(std::vector<Ast::Node *> &children) {
+    replace_chains(children,
+        [](Ast::Node *first, Ast::Node *node) {
+            int64_t target = transfer_loop_target(node);
+            return target != 0 && target == transfer_loop_target(first);
+        },
+        [](Ast::Node *first, size_t count, int64_t step) {
+            return new Ast::TransferChainNode(count, step, transfer_loop_target(first));
+        });
+}
+
+// Replace loops from the idiom library with a division
+static void idioms(std::vector<Ast::Node *> &children) {
+    for (auto &child: children) {
+        if (!isa<Ast::ConditionalGroupNode>(child)) {
+            continue;
+        }
+        std::ostringstream source;
+        child->debug_print(source);
+        int64_t direction;
+        if (const Idioms::DivMod *idiom = Idioms::match(source.str(), direction)) {
+            child = new Ast::DivModNode(*idiom, direction, child);
+        }
+    }
+}
+
+static std::vector<Ast::Node *> build(EGraph::Graph &graph, std::map<unsigned, EGraph::ENode> &best, unsigned id) {
+    std::vector<Ast::Node *> nodes;
+    while (true) {
+        const EGraph::ENode &node = best.at(graph.find(id));
+        switch (node.op) {
+            case EGraph::NIL:
+                return nodes;
+            case EGraph::ADD:
+                nodes.push_back(new Ast::AddNode(node.offset, node.value));
+                break;
+            case EGraph::SET:
+                nodes.push_back(new Ast::SetNode(node.offset, node.value));
+                break;
+            case EGraph::MOVE:
+                nodes.push_back(new Ast::MoveNode(node.offset));
+                break;
+            case EGraph::MUL_ADD:
+                nodes.push_back(new Ast::MultiplyAddNode(node.offset, node.source, node.value));
+                break;
+            case EGraph::LOOP:
+                nodes.push_back(new Ast::ConditionalGroupNode(build(graph, best, node.children[0]), node.offset));
+                break;
+            case EGraph::OPAQUE:
+                nodes.push_back(graph.opaque[node.offset]);
+                break;
+        }
+        id = node.rest();
+    }
+}
+
+// Rewrite a scope with equality saturation and pick the cheapest program.
+// Long scopes are rewritten in windows, saturating a graph grows
+// much faster than linearly with the size of the program.
+static void egraph(std::vector<Ast::Node *> &children) {
+    std::vector<Ast::Node *> result;
+    for (size_t start = 0; start < children.size(); start += EGraph::WINDOW) {
+        size_t end = std::min(start + EGraph::WINDOW, children.size());
+
+        EGraph::Graph graph;
+        unsigned program = graph.add(EGraph::make(EGraph::NIL, 0, 0, 0, {}));
+        for (size_t i = end; i > start; i--) {
+            program = children[i - 1]->add_to_egraph(graph, program);
+        }
+
+        EGraph::saturate(graph);
+        std::map<unsigned, EGraph::ENode> best = EGraph::extract(graph);
+        std::vector<Ast::Node *> window = build(graph, best, program);
+        result.insert(result.end(), window.begin(), window.end());
+    }
+    children = std::move(result);
+}
+
+// Replace loops that only do arithmetic with their closed form
+static void closed_forms(std::vector<Ast::Node *> &children) {
+    for (auto &child: children) {
+        auto *loop = dyn_cast<Ast::ConditionalGroupNode>(child);
+        ClosedForm::LoopEffect effect;
+        if (loop && loop->closed_form(effect)) {
+            child = new Ast::ClosedFormLoopNode(std::move(effect), loop);
+        }
+    }
+}
+
+#ifndef BFLLVM_LIBRARY
+// Drop the loops the analysis found are never entered
+static void dead_loops(std::vector<Ast::Node *> &children) {
+    children.erase(std::remove_if(children.begin(), children.end(), [](Ast::Node *child) {
+        return (isa<Ast::ConditionalGroupNode>(child) || isa<Ast::ClosedFormLoopNode>(child))
+            && !(Analysis::outcomes(Analysis::Entries, child) & Analysis::NONZERO);
+    }), children.end());
+}
+#endif
+
+struct Pass {
+    const char *name;
+    void (*run)(std::vector<Ast::Node *> &children);
+};
+
+static const Pass Pipeline[] = {
+    { "idioms", idioms },
+    { "clear-ranges", clear_ranges },
+    { "transfer-chains", transfer_chains },
+    { "egraph", egraph },
+    { "closed-forms", closed_forms },
+};
+
+// The passes that take time linear in the size of the program, for
+// backends that care more about compile time than about the code
+static const Pass LinearPipeline[] = {
+    { "clear-ranges", clear_ranges },
+    { "transfer-chains", transfer_chains },
+};
+
+// Apply a pass to the children of every scope, innermost scopes first
+static void run_on_scopes(Ast::Node *node, const Pass &pass) {
+    auto *scope = dyn_cast<Ast::ScopeNode>(node);
+    if (!scope) {
+        return;
+    }
+    for (auto child: scope->get_children()) {
+        run_on_scopes(child, pass);
+    }
+    pass.run(scope->get_children());
+}
+
+// The rewrites that only look at the nodes they rewrite, and so
+// also hold for a part of a program
+static void run_pipeline(Ast::Node *root) {
+    for (auto &pass: Pipeline) {
+        run_on_scopes(root, pass);
+        TimeReport::node_count(std::string("after ") + pass.name, root->count_nodes());
+    }
+}
+
+#ifndef BFLLVM_LIBRARY
+static void run_linear_pipeline(Ast::Node *root) {
+    TimeReport::Scope phase("ast passes");
+    for (auto &pass: LinearPipeline) {
+        run_on_scopes(root, pass);
+        TimeReport::node_count(std::string("after ") + pass.name, root->count_nodes());
+    }
+}
+
+static void run(Ast::Node *root) {
+    TimeReport::Scope phase("ast passes");
+    run_pipeline(root);
+
+    // What the analysis finds only holds for the tree it ran on,
+    // so it comes after every pass that rewrites the tree
+    Analysis::clear();
+    Analysis::State start;
+    root->analyze(start);
+    Analysis::Ran = true;
+    run_on_scopes(root, { "dead-loops", dead_loops });
+    TimeReport::node_count("after analysis", root->count_nodes());
+}
+#endif
+}
+
+Ast::Node* Ast::Node::try_parse(istream &in) {
+    while(true) {
+        char c;
+        if (!(in >> c)) {
+            return NULL;
+        }
         
         switch (c) {
             case '+':
@@ -407,60 +4511,2555 @@ Ast::Node* Ast::Node::try_parse(fstream &in) {
     }
 }
 
-Ast::Node* Ast::ProgramNode::try_parse(fstream &in) {
-    std::vector<Ast::Node *> children = {};
+Ast::Node* Ast::ProgramNode::try_parse(istream &in) {
+    std::vector<Ast::Node *> children = {};
+
+    Ast::Node* node;
+    while ((node = Ast::Node::try_parse(in))) {
+        children.push_back(node);
+    }
+
+    return new Ast::ProgramNode(std::move(children));
+}
+
+Ast::Node* Ast::ConditionalGroupNode::try_parse(istream &in) {
+    // The opening bracket has already been consumed
+    size_t source_offset = (size_t)in.tellg() - 1;
+    std::vector<Ast::Node *> children = {};
+
+    Ast::Node* node;
+    while ((node = Ast::Node::try_parse(in))) {
+        children.push_back(node);
+    }
+
+    return new Ast::ConditionalGroupNode(std::move(children), source_offset);
+}
+
+static void Ast::free_nodes() {
+    for (Node *node: AllNodes) {
+        delete node;
+    }
+    AllNodes.clear();
+}
+
+#ifndef BFLLVM_LIBRARY
+// Set up the LLVM globals and emit IR for the program into TheModule
+static bool codegen_program(Ast::Node *root, std::string &error) {
+    // Setup LLVM data structures
+    {
+        TimeReport::Scope phase("llvm_init");
+        llvm_init();
+    }
+
+    // Emit LLVM IR code
+    {
+        TimeReport::Scope phase("codegen");
+        root->codegen();
+
+        // The analysis results point into the tree
+        Analysis::clear();
+    }
+
+    if (!TheModule->getFunction("main")) {
+        error = "main() was not defined";
+        return false;
+    }
+    return true;
+}
+#endif
+
+// The number of modules to split the current module into for --jobs
+static unsigned count_partitions() {
+    unsigned functions = 0;
+    for (Function &function: *TheModule) {
+        functions += !function.isDeclaration();
+    }
+    return std::min((unsigned)Jobs, functions);
+}
+
+static void optimize_functions(legacy::FunctionPassManager &fpm, Module &module) {
+    for (Function &function: module) {
+        if (!function.isDeclaration()) {
+            fpm.run(function);
+        }
+    }
+}
+
+// Split the current module into `partitions` modules and optimize them
+// on a thread each. An LLVMContext can't be shared between threads, so
+// the partitions travel as bitcode and are linked back together in
+// TheContext afterwards.
+static bool optimize_in_parallel(unsigned partitions, std::string &error) {
+    std::vector<GlobalObject *> locals;
+    for (GlobalObject &object: TheModule->global_objects()) {
+        if (object.hasLocalLinkage()) {
+            locals.push_back(&object);
+        }
+    }
+
+    std::vector<SmallVector<char, 0>> bitcode;
+    SplitModule(*TheModule, partitions, [&](std::unique_ptr<Module> partition) {
+        bitcode.emplace_back();
+        raw_svector_ostream out(bitcode.back());
+        WriteBitcodeToFile(*partition, out);
+    });
+
+    // Splitting names the unnamed ones
+    std::set<std::string> internal;
+    for (GlobalObject *object: locals) {
+        internal.insert(object->getName().str());
+    }
+
+    ThreadPool pool(hardware_concurrency(partitions));
+    for (SmallVector<char, 0> &code: bitcode) {
+        pool.async([&code]() {
+            LLVMContext context;
+            std::unique_ptr<Module> module = cantFail(parseBitcodeFile(
+                MemoryBufferRef(StringRef(code.data(), code.size()), "partition"),
+                context
+            ));
+            optimize_functions(*create_function_pass_manager(module.get()), *module);
+
+            code.clear();
+            raw_svector_ostream out(code);
+            WriteBitcodeToFile(*module, out);
+        });
+    }
+    pool.wait();
+
+    auto linked = std::make_unique<Module>("brainfuck", *TheContext);
+    Linker linker(*linked);
+    for (SmallVector<char, 0> &code: bitcode) {
+        bool failed = linker.linkInModule(cantFail(parseBitcodeFile(
+            MemoryBufferRef(StringRef(code.data(), code.size()), "partition"),
+            *TheContext
+        )));
+        if (failed) {
+            error = "Failed to link the optimized partitions";
+            return false;
+        }
+    }
+
+    // Splitting made everything visible across partitions
+    for (GlobalObject &object: linked->global_objects()) {
+        if (internal.count(object.getName().str())) {
+            object.setLinkage(GlobalValue::InternalLinkage);
+        }
+    }
+
+    TheModule = std::move(linked);
+    TheFPM = create_function_pass_manager(TheModule.get());
+    return true;
+}
+
+static bool optimize_program(std::string &error) {
+    TimeReport::Scope phase("optimize");
+
+    // Optimize main() and the functions split off from it
+    unsigned partitions = count_partitions();
+    if (partitions > 1) {
+        return optimize_in_parallel(partitions, error);
+    }
+    optimize_functions(*TheFPM, *TheModule);
+    return true;
+}
+
+#ifndef BFLLVM_LIBRARY
+// Parse a program and emit optimized IR for it into TheModule.
+static bool compile_module(std::istream &in, std::string &error) {
+    // build the AST
+    Ast::Node *root;
+    {
+        TimeReport::Scope phase("parse");
+        root = Ast::ProgramNode::try_parse(in);
+    }
+    if (!root) {
+        error = "Failed to parse AST";
+        return false;
+    }
+    TimeReport::node_count("parsed", root->count_nodes());
+
+    if (RunAstPasses) {
+        AstPasses::run(root);
+    }
+
+    if (!codegen_program(root, error)) {
+        return false;
+    }
+    return optimize_program(error);
+}
+#endif
+
+// Parse a program and emit optimized IR for a reentrant bf_run() into
+// TheModule. The caller owns the tape, so nothing is known about the
+// cells and the analysis is left out.
+static bool compile_entry(std::istream &in, std::string &error) {
+    Ast::Node *root;
+    {
+        TimeReport::Scope phase("parse");
+        root = Ast::ProgramNode::try_parse(in);
+    }
+    if (!root) {
+        error = "Failed to parse AST";
+        return false;
+    }
+    TimeReport::node_count("parsed", root->count_nodes());
+
+    if (RunAstPasses) {
+        AstPasses::run_pipeline(root);
+    }
+
+    Analysis::clear();
+    TapeLayout::Current = TapeLayout::plan();
+    TapeLayout::Margin = 0;
+    BoundsCheck::SourceOffset = 0;
+    {
+        TimeReport::Scope phase("llvm_init");
+        llvm_init();
+    }
+    {
+        TimeReport::Scope phase("codegen");
+        IOChannel::Active = true;
+        cast<Ast::ProgramNode>(root)->codegen_chunk("bf_run");
+        IOChannel::Active = false;
+    }
+    return optimize_program(error);
+}
+
+static std::unique_ptr<TargetMachine> create_target_machine(std::string &error) {
+    std::string triple = sys::getDefaultTargetTriple();
+    const Target *target = TargetRegistry::lookupTarget(triple, error);
+    if (!target) {
+        return nullptr;
+    }
+
+    TargetOptions options;
+    return std::unique_ptr<TargetMachine>(target->createTargetMachine(
+        triple,
+        sys::getHostCPUName(),
+        "",
+        options,
+        Reloc::PIC_
+    ));
+}
+
+// Compile the current module to native object files in memory, one
+// per partition of the module with --jobs
+static bool emit_objects(std::vector<SmallVector<char, 0>> &objects, std::string &error) {
+    std::unique_ptr<TargetMachine> target = create_target_machine(error);
+    if (!target) {
+        return false;
+    }
+    TheModule->setDataLayout(target->createDataLayout());
+    TheModule->setTargetTriple(target->getTargetTriple().str());
+
+    unsigned partitions = count_partitions();
+    if (partitions > 1) {
+        objects.resize(partitions);
+        std::vector<std::unique_ptr<raw_svector_ostream>> streams;
+        std::vector<raw_pwrite_stream *> object_outs;
+        for (SmallVector<char, 0> &object: objects) {
+            streams.push_back(std::make_unique<raw_svector_ostream>(object));
+            object_outs.push_back(streams.back().get());
+        }
+        splitCodeGen(*TheModule, object_outs, {}, [&]() {
+            std::string error;
+            return create_target_machine(error);
+        });
+        return true;
+    }
+
+    objects.resize(1);
+    raw_svector_ostream out(objects[0]);
+    legacy::PassManager passes;
+    if (target->addPassesToEmitFile(passes, out, nullptr, CGFT_ObjectFile)) {
+        error = "Failed to emit object code";
+        return false;
+    }
+    passes.run(*TheModule);
+    return true;
+}
+
+// Create a JIT instance, which stores the code it compiles in `cache`
+// and takes it from there instead of compiling again if given
+static Expected<std::unique_ptr<orc::LLJIT>> create_jit(ObjectCache *cache = nullptr) {
+    orc::LLJITBuilder builder;
+    if (cache) {
+        builder.setCompileFunctionCreator([cache](orc::JITTargetMachineBuilder target)
+                -> Expected<std::unique_ptr<orc::IRCompileLayer::IRCompiler>> {
+            return std::make_unique<orc::ConcurrentIRCompiler>(std::move(target), cache);
+        });
+    }
+    auto jit = builder.create();
+    if (!jit) {
+        return jit.takeError();
+    }
+
+    // Resolve putchar() and getchar() from the host process
+    auto generator = orc::DynamicLibrarySearchGenerator::GetForCurrentProcess(
+        (*jit)->getDataLayout().getGlobalPrefix()
+    );
+    if (!generator) {
+        return generator.takeError();
+    }
+    (*jit)->getMainJITDylib().addGenerator(std::move(*generator));
+    return jit;
+}
+
+static Error add_objects(orc::LLJIT &jit, std::vector<SmallVector<char, 0>> &objects, StringRef name) {
+    for (SmallVector<char, 0> &object: objects) {
+        StringRef object_data(object.data(), object.size());
+        if (Error err = jit.addObjectFile(MemoryBuffer::getMemBufferCopy(object_data, name))) {
+            return err;
+        }
+    }
+    return Error::success();
+}
+
+// Move the current module into a new JIT instance, which stores its
+// object code in `cache` if given.
+// The LLVM globals have to be set up again with llvm_init() afterwards.
+static Expected<std::unique_ptr<orc::LLJIT>> jit_module(ObjectCache *cache = nullptr) {
+    auto jit = create_jit(cache);
+    if (!jit) {
+        return jit.takeError();
+    }
+
+    // The JIT compiles a module on a single thread, so with --jobs the
+    // partitions are compiled up front. A cache only holds whole modules.
+    if (!cache && count_partitions() > 1) {
+        std::vector<SmallVector<char, 0>> objects;
+        std::string error;
+        if (!emit_objects(objects, error)) {
+            return make_error<StringError>(error, inconvertibleErrorCode());
+        }
+        if (Error err = add_objects(**jit, objects, "brainfuck")) {
+            return err;
+        }
+        TheFPM.reset();
+        Builder.reset();
+        TheModule.reset();
+        TheContext.reset();
+        return jit;
+    }
+
+    // Both of these refer to the module we are about to give away
+    TheFPM.reset();
+    Builder.reset();
+
+    orc::ThreadSafeModule module(std::move(TheModule), std::move(TheContext));
+    if (Error err = (*jit)->addIRModule(std::move(module))) {
+        return err;
+    }
+    return jit;
+}
+
+// The command line tools, which the library leaves out
+#ifndef BFLLVM_LIBRARY
+// Look up (and thereby compile) the main() function of a JIT-ed module
+static Expected<void (*)()> jit_entry_point(orc::LLJIT &jit) {
+    auto symbol = jit.lookup("main");
+    if (!symbol) {
+        return symbol.takeError();
+    }
+    return jitTargetAddressToPointer<void (*)()>(symbol->getAddress());
+}
+
+namespace DiskCache {
+
+// Identifies the code compiling `source` results in: the source, every
+// option that changes the code, and the compiler and host it's for
+static std::string key(const std::string &source) {
+    std::string identity;
+    raw_string_ostream out(identity);
+    out << LLVM_VERSION_STRING << " " << sys::getHostCPUName() << " " << __DATE__ << " " << __TIME__ << "\n"
+        << PromoteCells << RunAstPasses << BoundsChecks << Profile << ProfileCycles << " "
+        << TapeSize << " " << OutlineThreshold << " " << ProfileOutput << "\n";
+    if (!ProfileUse.empty()) {
+        auto profile = MemoryBuffer::getFile(ProfileUse);
+        if (profile) {
+            out << (*profile)->getBuffer();
+        }
+    }
+    out.flush();
+
+    MD5 md5;
+    md5.update(identity);
+    md5.update(source);
+    MD5::MD5Result hash;
+    md5.final(hash);
+    return hash.digest().str().str();
+}
+
+// Object files in a directory, named after the identifier of the
+// module they were compiled from
+class Cache: public ObjectCache {
+    std::string directory;
+
+    std::string path(StringRef key) const {
+        return directory + "/" + key.str() + ".o";
+    }
+
+public:
+    explicit Cache(std::string directory): directory(std::move(directory)) {}
+
+    std::unique_ptr<MemoryBuffer> load(StringRef key) {
+        auto object = MemoryBuffer::getFile(path(key));
+        if (!object) {
+            return nullptr;
+        }
+        return std::move(*object);
+    }
+
+    std::unique_ptr<MemoryBuffer> getObject(const Module *module) override {
+        return load(module->getModuleIdentifier());
+    }
+
+    // Write to a temporary file first, so that concurrent runs never
+    // see half an object. Failing to cache only costs time later.
+    void notifyObjectCompiled(const Module *module, MemoryBufferRef object) override {
+        if (sys::fs::create_directories(directory)) {
+            return;
+        }
+        std::string final_path = path(module->getModuleIdentifier());
+        std::string temporary_path = final_path + "." + std::to_string(getpid());
+        {
+            std::error_code error;
+            raw_fd_ostream out(temporary_path, error);
+            if (error) {
+                return;
+            }
+            out << object.getBuffer();
+        }
+        if (sys::fs::rename(temporary_path, final_path)) {
+            sys::fs::remove(temporary_path);
+        }
+    }
+};
+}
+
+namespace Server {
+
+// Request protocol (one request per connection):
+//     "compile <length>\n" <source>  -> "ok\n" <llvm ir>
+//     "run <length>\n" <source> <program input...> -> "ok\n" <program output...>
+// Failures are answered with "error <message>\n".
+struct CachedProgram {
+    std::mutex lock;
+    bool compiled = false;
+    std::string error;
+    std::string ir;
+    std::unique_ptr<orc::LLJIT> jit;
+    void (*entry)() = nullptr;
+};
+
+// Requests with more source than this are turned away
+const size_t MAX_SOURCE_SIZE = 64 << 20;
+
+// Compiled programs, most recently used first. Connections hold on to
+// their entry, so dropping one never pulls it out from under them.
+struct CacheSlot {
+    std::shared_ptr<CachedProgram> program;
+    std::list<std::string>::iterator recent;
+};
+
+static std::mutex CacheLock;
+static std::list<std::string> Recent;
+static std::unordered_map<std::string, CacheSlot> Cache;
+
+static std::shared_ptr<CachedProgram> get_cache_entry(StringRef source) {
+    MD5 md5;
+    md5.update(source);
+    MD5::MD5Result hash;
+    md5.final(hash);
+    std::string key = hash.digest().str().str();
+
+    // Free the dropped program (and its JIT) after letting go of the lock
+    std::shared_ptr<CachedProgram> dropped;
+    std::lock_guard<std::mutex> guard(CacheLock);
+    auto found = Cache.find(key);
+    if (found != Cache.end()) {
+        Recent.splice(Recent.begin(), Recent, found->second.recent);
+        return found->second.program;
+    }
+
+    Recent.push_front(key);
+    std::shared_ptr<CachedProgram> entry = std::make_shared<CachedProgram>();
+    Cache[key] = { entry, Recent.begin() };
+    if (Cache.size() > ServeCacheSize) {
+        auto oldest = Cache.find(Recent.back());
+        dropped = std::move(oldest->second.program);
+        Cache.erase(oldest);
+        Recent.pop_back();
+    }
+    return entry;
+}
+
+// The parser wants an istream that can tell its position, this one reads
+// the source straight out of the request buffer
+class SourceBuffer: public std::streambuf {
+public:
+    explicit SourceBuffer(MutableArrayRef<char> source) {
+        setg(source.begin(), source.begin(), source.end());
+    }
+
+protected:
+    pos_type seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode) override {
+        char *base = direction == std::ios_base::beg ? eback()
+            : direction == std::ios_base::cur ? gptr()
+            : egptr();
+        if (offset < eback() - base || offset > egptr() - base) {
+            return pos_type(off_type(-1));
+        }
+        setg(eback(), base + offset, egptr());
+        return pos_type(gptr() - eback());
+    }
+
+    pos_type seekpos(pos_type position, std::ios_base::openmode mode) override {
+        return seekoff(off_type(position), std::ios_base::beg, mode);
+    }
+};
+
+// Fill in a cache entry, called with the entry lock held
+static void compile_cache_entry(CachedProgram &program, MutableArrayRef<char> source) {
+    program.compiled = true;
+
+    SourceBuffer buffer(source);
+    std::istream in(&buffer);
+    bool compiled = compile_module(in, program.error);
+    Ast::free_nodes();
+    if (!compiled) {
+        return;
+    }
+
+    raw_string_ostream ir(program.ir);
+    TheModule->print(ir, nullptr);
+    ir.flush();
+
+    auto jit = jit_module();
+    if (!jit) {
+        program.error = toString(jit.takeError());
+        return;
+    }
+    program.jit = std::move(*jit);
+}
+
+static bool read_exactly(int fd, char *buffer, size_t size) {
+    while (size > 0) {
+        ssize_t n = read(fd, buffer, size);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        buffer += n;
+        size -= n;
+    }
+    return true;
+}
+
+static bool write_all(int fd, const std::string &data) {
+    const char *buffer = data.data();
+    size_t size = data.size();
+    while (size > 0) {
+        ssize_t n = write(fd, buffer, size);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        buffer += n;
+        size -= n;
+    }
+    return true;
+}
+
+// Read the request header byte by byte, so that we never consume
+// any of the program input that follows it
+static bool read_line(int fd, std::string &line) {
+    char c;
+    while (read_exactly(fd, &c, 1)) {
+        if (c == '\n') {
+            return true;
+        }
+        line.push_back(c);
+    }
+    return false;
+}
+
+// Wait for a program run to finish. It is killed when the client hangs up
+// or when it runs for longer than --serve-timeout, so that it cannot
+// keep the worker from taking on other requests.
+static void wait_for_run(pid_t child, int fd) {
+    using Clock = std::chrono::steady_clock;
+    Clock::time_point deadline = Clock::now() + std::chrono::seconds(ServeTimeout);
+
+    // A pidfd becomes readable when the child exits. Without one,
+    // check on the child every few milliseconds.
+    int exited = syscall(SYS_pidfd_open, child, 0);
+    pollfd fds[2] = { { fd, 0, 0 }, { exited, POLLIN, 0 } };
+    bool running;
+    while ((running = waitpid(child, nullptr, WNOHANG) == 0)) {
+        int timeout = exited < 0 ? 10 : -1;
+        if (ServeTimeout) {
+            auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - Clock::now());
+            int left = (int)std::max<int64_t>(remaining.count(), 0);
+            timeout = timeout < 0 ? left : std::min(timeout, left);
+        }
+        if (poll(fds, 2, timeout) < 0 && errno != EINTR) {
+            break;
+        }
+        if ((fds[0].revents & (POLLHUP | POLLERR)) || (ServeTimeout && Clock::now() >= deadline)) {
+            break;
+        }
+    }
+
+    if (running) {
+        kill(child, SIGKILL);
+        waitpid(child, nullptr, 0);
+    }
+    if (exited >= 0) {
+        close(exited);
+    }
+}
+
+static void handle_connection(int fd) {
+    std::string header;
+    if (!read_line(fd, header)) {
+        return;
+    }
+
+    std::istringstream header_stream(header);
+    std::string command;
+    size_t length;
+    if (!(header_stream >> command >> length) || (command != "compile" && command != "run")) {
+        write_all(fd, "error malformed request\n");
+        return;
+    }
+
+    if (length > MAX_SOURCE_SIZE) {
+        write_all(fd, "error request too large\n");
+        return;
+    }
+
+    // Without exceptions, a failed std::string allocation would end the server
+    std::unique_ptr<WritableMemoryBuffer> source = WritableMemoryBuffer::getNewUninitMemBuffer(length);
+    if (!source) {
+        write_all(fd, "error out of memory\n");
+        return;
+    }
+    if (!read_exactly(fd, source->getBufferStart(), length)) {
+        return;
+    }
+
+    std::shared_ptr<CachedProgram> program = get_cache_entry(StringRef(source->getBufferStart(), length));
+    void (*entry)() = nullptr;
+    {
+        std::lock_guard<std::mutex> guard(program->lock);
+        if (!program->compiled) {
+            compile_cache_entry(*program, source->getBuffer());
+        }
+
+        if (program->error.empty() && command == "run" && !program->entry) {
+            auto symbol = jit_entry_point(*program->jit);
+            if (symbol) {
+                program->entry = *symbol;
+            } else {
+                program->error = toString(symbol.takeError());
+            }
+        }
+
+        if (!program->error.empty()) {
+            write_all(fd, "error " + program->error + "\n");
+            return;
+        }
+
+        if (command == "compile") {
+            write_all(fd, "ok\n" + program->ir);
+            return;
+        }
+        entry = program->entry;
+    }
+
+    if (!write_all(fd, "ok\n")) {
+        return;
+    }
+
+    // Run the program in a child process that talks to the client
+    // over its stdin and stdout, so a misbehaving program cannot take
+    // the server down with it
+    pid_t child = fork();
+    if (child == 0) {
+        dup2(fd, STDIN_FILENO);
+        dup2(fd, STDOUT_FILENO);
+        entry();
+        fflush(stdout);
+        _exit(0);
+    }
+    if (child > 0) {
+        wait_for_run(child, fd);
+    }
+}
+
+static int serve(const std::string &path) {
+    signal(SIGPIPE, SIG_IGN);
+
+    sockaddr_un address = {};
+    address.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(address.sun_path)) {
+        std::cerr << "Socket path is too long" << std::endl;
+        return -1;
+    }
+    strcpy(address.sun_path, path.c_str());
+
+    int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    unlink(path.c_str());
+    if (listener < 0
+        || bind(listener, (sockaddr *)&address, sizeof(address)) < 0
+        || listen(listener, SOMAXCONN) < 0) {
+        std::cerr << "Failed to listen on " << path << ": " << strerror(errno) << std::endl;
+        return -1;
+    }
+
+    // Every worker accepts connections on its own and keeps its LLVM state warm
+    std::vector<std::thread> workers;
+    for (unsigned i = 0; i < std::max(1u, (unsigned)ServeWorkers); i++) {
+        workers.emplace_back([listener] {
+            while (true) {
+                int fd = accept(listener, nullptr, nullptr);
+                if (fd < 0) {
+                    if (errno == EINTR || errno == ECONNABORTED) {
+                        continue;
+                    }
+                    return;
+                }
+                handle_connection(fd);
+                close(fd);
+            }
+        });
+    }
+
+    for (auto &worker: workers) {
+        worker.join();
+    }
+    return 0;
+}
+}
+
+namespace X86 {
+
+// Registers as x86 encodes them
+enum Register {
+    RAX = 0,
+    RCX = 1,
+    RDX = 2,
+    RBX = 3,
+    RSI = 6,
+    RDI = 7,
+    R12 = 12,
+    R13 = 13,
+};
+
+// Where the ELF executable is loaded, and its data segment
+const uint64_t CODE_ADDRESS = 0x400000;
+const uint64_t DATA_ADDRESS = 0x20000000;
+
+// The data segment of the executable: the I/O table the program calls
+// through, the byte read by the last read() and the output buffer
+const uint64_t IO_TABLE = DATA_ADDRESS;
+const uint64_t INPUT_BYTE = DATA_ADDRESS + 16;
+const uint64_t OUTPUT_LENGTH = DATA_ADDRESS + 24;
+const uint64_t OUTPUT_BUFFER = DATA_ADDRESS + 32;
+const uint64_t OUTPUT_BUFFER_SIZE = 4096;
+
+// Appends machine code to a buffer. Only knows the handful of
+// instructions the backend needs, with their operands fixed.
+class Assembler {
+    std::vector<uint8_t> code;
+
+public:
+    const std::vector<uint8_t>& get_code() const {
+        return code;
+    }
+
+    size_t size() const {
+        return code.size();
+    }
+
+    void bytes(std::initializer_list<uint8_t> list) {
+        code.insert(code.end(), list);
+    }
+
+    void imm32(int64_t value) {
+        for (int i = 0; i < 4; i++) {
+            code.push_back((uint64_t)value >> (8 * i));
+        }
+    }
+
+    void imm64(uint64_t value) {
+        for (int i = 0; i < 8; i++) {
+            code.push_back(value >> (8 * i));
+        }
+    }
+
+    void append(const std::vector<uint8_t> &bytes) {
+        code.insert(code.end(), bytes.begin(), bytes.end());
+    }
+
+    // Overwrite the `size` bytes at `at` with `value`
+    void write(size_t at, uint64_t value, unsigned size) {
+        for (unsigned i = 0; i < size; i++) {
+            code[at + i] = value >> (8 * i);
+        }
+    }
+
+    // Point the rel32 at `at` to `target`
+    void patch(size_t at, size_t target) {
+        write(at, (int64_t)target - (int64_t)(at + 4), 4);
+    }
+
+    // A jump or call with the opcode `opcode` to `target`, or to
+    // nowhere yet. Returns where its rel32 goes.
+    size_t jump(std::initializer_list<uint8_t> opcode, size_t target = 0) {
+        bytes(opcode);
+        size_t at = size();
+        imm32(0);
+        if (target) {
+            patch(at, target);
+        }
+        return at;
+    }
+
+    // mov <reg>, imm64
+    void mov_imm64(Register reg, uint64_t value) {
+        bytes({ (uint8_t)(0x48 | (reg >> 3)), (uint8_t)(0xB8 | (reg & 7)) });
+        imm64(value);
+    }
+
+    // mov <reg>, imm32
+    void mov_imm32(Register reg, uint32_t value) {
+        if (reg >= 8) {
+            bytes({ 0x41 });
+        }
+        bytes({ (uint8_t)(0xB8 | (reg & 7)) });
+        imm32(value);
+    }
+
+    // <opcode> with ModRM byte addressing [rbx + disp32]
+    void cell(std::initializer_list<uint8_t> opcode, unsigned reg, int64_t offset) {
+        bytes(opcode);
+        bytes({ (uint8_t)(0x80 | (reg << 3) | RBX) });
+        imm32(offset);
+    }
+
+    void syscall() {
+        bytes({ 0x0F, 0x05 });
+    }
+
+    void ret() {
+        bytes({ 0xC3 });
+    }
+};
+
+// The net change of a loop body made of + - < > only to each cell
+// relative to where it starts, or false if the body does anything else
+// or doesn't return to the cell it started at
+static bool loop_effect(Ast::ConditionalGroupNode *loop, std::map<int64_t, uint8_t> &effect) {
+    int64_t position = 0;
+    for (Ast::Node *child: loop->get_children()) {
+        if (isa<Ast::IncrementNode>(child)) {
+            effect[position] += 1;
+        } else if (isa<Ast::DecrementNode>(child)) {
+            effect[position] -= 1;
+        } else if (isa<Ast::MoveRightNode>(child)) {
+            position++;
+        } else if (isa<Ast::MoveLeftNode>(child)) {
+            position--;
+        } else {
+            return false;
+        }
+    }
+    return position == 0;
+}
+
+// [-], [+] and multiplication loops like [->++>+<<]: the products of
+// c[0] the loop adds to each other cell, or false for any other loop
+static bool multiply_loop(Ast::ConditionalGroupNode *loop, std::map<int64_t, uint8_t> &products) {
+    std::map<int64_t, uint8_t> effect;
+    if (!loop_effect(loop, effect) || (effect[0] != 1 && effect[0] != 255)) {
+        return false;
+    }
+    for (auto &cell: effect) {
+        if (cell.first != 0 && cell.second != 0) {
+            // The loop runs c[0] times when it counts down and
+            // -c[0] times when it counts up
+            products[cell.first] = effect[0] == 255 ? cell.second : (uint8_t)-cell.second;
+        }
+    }
+    return true;
+}
+
+// Emit a multiplication loop at `cell` with either backend's emitter:
+// add c[cell] times each of `products` to its cell and clear c[cell].
+// The loop only gets to the other cells if c[cell] isn't zero, which
+// they need not be on the tape otherwise, so they are skipped then.
+template <typename Emitter>
+static void emit_multiply_loop(Emitter &emitter, int64_t cell, const std::map<int64_t, uint8_t> &products) {
+    if (products.empty()) {
+        emitter.set(cell, 0);
+        return;
+    }
+    size_t skip = emitter.skip_if_zero(cell);
+    for (auto &product: products) {
+        emitter.multiply_add(cell + product.first, cell, product.second);
+    }
+    emitter.set(cell, 0);
+    emitter.end_skip(skip);
+}
+
+// Emits a program into an assembler as a function, given the address of
+// the table of putchar() and getchar() it calls. Returns where it starts.
+using EmitFunction = std::function<size_t(Assembler &, uint64_t)>;
+
+// Emits a parsed program as a function that maps a tape, runs the
+// program on it and unmaps it. Counts of + - < > are folded, moves
+// become displacements until a loop or I/O needs the head in rbx, and
+// clear and multiplication loops are replaced by what they compute.
+//
+// rbx points at the cell `offset` cells before the head, r12 at a table
+// of putchar() and getchar(), r13 at the tape
+class Emitter {
+    template <typename E>
+    friend void emit_multiply_loop(E &emitter, int64_t cell, const std::map<int64_t, uint8_t> &products);
+
+    Assembler &out;
+    uint64_t io_table;
+
+    int64_t offset = 0;
+
+    // The add or set on the cell at `at` that is yet to be emitted
+    bool pending = false;
+    bool pending_set = false;
+    int64_t pending_at = 0;
+    uint8_t pending_value = 0;
+
+    // The moves stay within a 32 bit displacement
+    const int64_t MAX_OFFSET = 1 << 30;
+
+    void flush_pending() {
+        if (!pending) {
+            return;
+        }
+        pending = false;
+        if (pending_set) {
+            // mov byte [rbx + disp32], imm8
+            out.cell({ 0xC6 }, 0, pending_at);
+            out.bytes({ pending_value });
+        } else if (pending_value != 0) {
+            // add byte [rbx + disp32], imm8
+            out.cell({ 0x80 }, 0, pending_at);
+            out.bytes({ pending_value });
+        }
+    }
+
+    void flush_offset() {
+        flush_pending();
+        if (offset != 0) {
+            // add rbx, imm32
+            out.bytes({ 0x48, 0x81, 0xC3 });
+            out.imm32(offset);
+            offset = 0;
+        }
+    }
+
+    void add(uint8_t value) {
+        if (pending && pending_at == offset) {
+            pending_value += value;
+            return;
+        }
+        flush_pending();
+        pending = true;
+        pending_set = false;
+        pending_at = offset;
+        pending_value = value;
+    }
+
+    void set(int64_t cell, uint8_t value) {
+        flush_pending();
+        pending = true;
+        pending_set = true;
+        pending_at = offset + cell;
+        pending_value = value;
+    }
+
+    void move(int64_t step) {
+        offset += step;
+        if (offset > MAX_OFFSET || offset < -MAX_OFFSET) {
+            flush_offset();
+        }
+    }
+
+    // c[cell] += c[source] * factor
+    void multiply_add(int64_t cell, int64_t source, uint8_t factor) {
+        flush_pending();
+        // movzx eax, byte [rbx + disp32]
+        out.cell({ 0x0F, 0xB6 }, RAX, offset + source);
+        if (factor != 1) {
+            // imul eax, eax, imm32
+            out.bytes({ 0x69, 0xC0 });
+            out.imm32(factor);
+        }
+        // add byte [rbx + disp32], al
+        out.cell({ 0x00 }, RAX, offset + cell);
+    }
+
+    // cmp byte [rbx + disp32], 0 and je to where end_skip() is called
+    size_t skip_if_zero(int64_t cell) {
+        flush_pending();
+        out.cell({ 0x80 }, 7, offset + cell);
+        out.bytes({ 0 });
+        return out.jump({ 0x0F, 0x84 });
+    }
+
+    void end_skip(size_t skip) {
+        flush_pending();
+        out.patch(skip, out.size());
+    }
+
+    void emit_loop(Ast::ConditionalGroupNode *loop) {
+        // Clear and multiplication loops
+        std::map<int64_t, uint8_t> products;
+        if (multiply_loop(loop, products)) {
+            emit_multiply_loop(*this, 0, products);
+            return;
+        }
+
+        flush_offset();
+        // cmp byte [rbx + 0], 0 and je to after the loop
+        out.cell({ 0x80 }, 7, 0);
+        out.bytes({ 0 });
+        size_t skip = out.jump({ 0x0F, 0x84 });
+
+        size_t body = out.size();
+        emit_children(loop->get_children());
+        flush_offset();
+
+        // cmp byte [rbx + 0], 0 and jne back to the body
+        out.cell({ 0x80 }, 7, 0);
+        out.bytes({ 0 });
+        out.jump({ 0x0F, 0x85 }, body);
+        out.patch(skip, out.size());
+    }
+
+    void emit_children(std::vector<Ast::Node *> &children) {
+        for (Ast::Node *child: children) {
+            switch (child->getKind()) {
+                case Ast::Node::NK_Increment:
+                    add(1);
+                    break;
+                case Ast::Node::NK_Decrement:
+                    add(255);
+                    break;
+                case Ast::Node::NK_MoveRight:
+                    move(1);
+                    break;
+                case Ast::Node::NK_MoveLeft:
+                    move(-1);
+                    break;
+                case Ast::Node::NK_PutChar:
+                    flush_pending();
+                    // movzx edi, byte [rbx + disp32] and call [r12]
+                    out.cell({ 0x0F, 0xB6 }, RDI, offset);
+                    out.bytes({ 0x41, 0xFF, 0x14, 0x24 });
+                    break;
+                case Ast::Node::NK_GetChar:
+                    flush_pending();
+                    // call [r12 + 8] and mov byte [rbx + disp32], al
+                    out.bytes({ 0x41, 0xFF, 0x54, 0x24, 0x08 });
+                    out.cell({ 0x88 }, RAX, offset);
+                    break;
+                case Ast::Node::NK_ConditionalGroup:
+                    emit_loop(cast<Ast::ConditionalGroupNode>(child));
+                    break;
+                default:
+                    llvm_unreachable("the x86 backend only emits parsed programs");
+            }
+        }
+    }
+
+public:
+    Emitter(Assembler &out, uint64_t io_table): out(out), io_table(io_table) {}
+
+    // Emit the program as a function, returns where it starts
+    size_t emit(Ast::ProgramNode *program) {
+        size_t entry = out.size();
+
+        // Without the analysis, this is the tape the LLVM backend would map
+        Analysis::clear();
+        TapeLayout::Layout layout = TapeLayout::plan();
+
+        // push rbx, push r12 and push r13, which also aligns the stack
+        out.bytes({ 0x53, 0x41, 0x54, 0x41, 0x55 });
+
+        // mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0)
+        out.mov_imm32(RAX, SYS_mmap);
+        out.bytes({ 0x31, 0xFF });
+        out.mov_imm64(RSI, layout.size);
+        out.mov_imm32(RDX, PROT_READ | PROT_WRITE);
+        out.bytes({ 0x41, 0xBA });
+        out.imm32(MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE);
+        out.bytes({ 0x49, 0xC7, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF });
+        out.bytes({ 0x45, 0x31, 0xC9 });
+        out.syscall();
+
+        // cmp rax, -4096 and ja to the error
+        out.bytes({ 0x48, 0x3D });
+        out.imm32(-4096);
+        size_t failed = out.jump({ 0x0F, 0x87 });
+
+        // mov r13, rax, mov rbx, rax and start at the program's start cell
+        out.bytes({ 0x49, 0x89, 0xC5, 0x48, 0x89, 0xC3 });
+        offset = layout.start;
+        out.mov_imm64(R12, io_table);
+
+        emit_children(program->get_children());
+
+        // munmap(tape, size)
+        out.mov_imm32(RAX, SYS_munmap);
+        out.bytes({ 0x4C, 0x89, 0xEF });
+        out.mov_imm64(RSI, layout.size);
+        out.syscall();
+
+        // pop r13, pop r12, pop rbx
+        size_t done = out.size();
+        out.bytes({ 0x41, 0x5D, 0x41, 0x5C, 0x5B });
+        out.ret();
+
+        // write(2, message, length) and return
+        static const char message[] = "tape: mmap failed\n";
+        out.patch(failed, out.size());
+        out.mov_imm32(RAX, SYS_write);
+        out.mov_imm32(RDI, STDERR_FILENO);
+        size_t message_at = out.jump({ 0x48, 0x8D, 0x35 });   // lea rsi, [rip + rel32]
+        out.mov_imm32(RDX, sizeof(message) - 1);
+        out.syscall();
+        out.jump({ 0xE9 }, done);
+        out.patch(message_at, out.size());
+        for (const char *c = message; *c; c++) {
+            out.bytes({ (uint8_t)*c });
+        }
+        return entry;
+    }
+};
+
+// The executable's replacements for putchar() and getchar(), which
+// buffer output with write() and read input with read()
+struct Runtime {
+    size_t put;
+    size_t get;
+    size_t flush;
+};
+
+static Runtime emit_runtime(Assembler &out) {
+    Runtime runtime;
+
+    // flush: write(1, buffer, length) if there is anything to write
+    runtime.flush = out.size();
+    out.mov_imm64(RCX, OUTPUT_LENGTH);
+    out.bytes({ 0x48, 0x8B, 0x11 });               // mov rdx, [rcx]
+    out.bytes({ 0x48, 0x85, 0xD2 });               // test rdx, rdx
+    size_t empty = out.jump({ 0x0F, 0x84 });       // jz to the ret
+    out.mov_imm64(RSI, OUTPUT_BUFFER);
+    out.mov_imm32(RDI, STDOUT_FILENO);
+    out.mov_imm32(RAX, SYS_write);
+    out.syscall();
+    out.mov_imm64(RCX, OUTPUT_LENGTH);             // syscall clobbers rcx
+    out.bytes({ 0x48, 0xC7, 0x01, 0, 0, 0, 0 });   // mov qword [rcx], 0
+    out.patch(empty, out.size());
+    out.ret();
+
+    // put: append dil to the buffer, flushing it once it's full
+    runtime.put = out.size();
+    out.mov_imm64(RCX, OUTPUT_LENGTH);
+    out.bytes({ 0x48, 0x8B, 0x01 });               // mov rax, [rcx]
+    out.bytes({ 0x40, 0x88, 0x7C, 0x01, 0x08 });   // mov [rcx + rax + 8], dil
+    out.bytes({ 0x48, 0xFF, 0xC0 });               // inc rax
+    out.bytes({ 0x48, 0x89, 0x01 });               // mov [rcx], rax
+    out.bytes({ 0x48, 0x3D });                     // cmp rax, imm32
+    out.imm32(OUTPUT_BUFFER_SIZE);
+    out.jump({ 0x0F, 0x84 }, runtime.flush);       // je flush, which returns for us
+    out.ret();
+
+    // get: flush the output, then read a byte or return EOF
+    runtime.get = out.size();
+    out.jump({ 0xE8 }, runtime.flush);
+    out.mov_imm64(RSI, INPUT_BYTE);
+    out.bytes({ 0x31, 0xFF });                     // xor edi, edi
+    out.mov_imm32(RDX, 1);
+    out.bytes({ 0x31, 0xC0 });                     // xor eax, eax, read() is 0
+    out.syscall();
+    out.bytes({ 0x48, 0x83, 0xF8, 0x01 });         // cmp rax, 1
+    out.bytes({ 0x75, 0x04 });                     // jne to the EOF
+    out.bytes({ 0x0F, 0xB6, 0x06 });               // movzx eax, byte [rsi]
+    out.ret();
+    out.mov_imm32(RAX, (uint32_t)EOF);
+    out.ret();
+
+    return runtime;
+}
+
+// Write the program as a static ELF executable
+static bool write_executable(const EmitFunction &emit, const std::string &path, std::string &error) {
+    const uint64_t headers = sizeof(Elf64_Ehdr) + 2 * sizeof(Elf64_Phdr);
+    Assembler out;
+
+    // _start: run the program, flush its output and exit(0)
+    size_t run_call = out.jump({ 0xE8 });
+    size_t flush_call = out.jump({ 0xE8 });
+    out.mov_imm32(RAX, SYS_exit);
+    out.bytes({ 0x31, 0xFF });
+    out.syscall();
+
+    Runtime runtime = emit_runtime(out);
+    out.patch(flush_call, runtime.flush);
+    out.patch(run_call, emit(out, IO_TABLE));
+
+    uint64_t io_table[2] = {
+        CODE_ADDRESS + headers + runtime.put,
+        CODE_ADDRESS + headers + runtime.get,
+    };
+
+    Elf64_Ehdr header = {};
+    memcpy(header.e_ident, ELFMAG, SELFMAG);
+    header.e_ident[EI_CLASS] = ELFCLASS64;
+    header.e_ident[EI_DATA] = ELFDATA2LSB;
+    header.e_ident[EI_VERSION] = EV_CURRENT;
+    header.e_ident[EI_OSABI] = ELFOSABI_SYSV;
+    header.e_type = ET_EXEC;
+    header.e_machine = EM_X86_64;
+    header.e_version = EV_CURRENT;
+    header.e_entry = CODE_ADDRESS + headers;
+    header.e_phoff = sizeof(Elf64_Ehdr);
+    header.e_ehsize = sizeof(Elf64_Ehdr);
+    header.e_phentsize = sizeof(Elf64_Phdr);
+    header.e_phnum = 2;
+
+    // The headers and code, then the data on a page of its own
+    uint64_t data_offset = alignTo(headers + out.size(), 0x1000);
+    Elf64_Phdr segments[2] = {};
+    segments[0].p_type = PT_LOAD;
+    segments[0].p_flags = PF_R | PF_X;
+    segments[0].p_offset = 0;
+    segments[0].p_vaddr = segments[0].p_paddr = CODE_ADDRESS;
+    segments[0].p_filesz = segments[0].p_memsz = headers + out.size();
+    segments[0].p_align = 0x1000;
+    segments[1].p_type = PT_LOAD;
+    segments[1].p_flags = PF_R | PF_W;
+    segments[1].p_offset = data_offset;
+    segments[1].p_vaddr = segments[1].p_paddr = DATA_ADDRESS;
+    segments[1].p_filesz = sizeof(io_table);
+    segments[1].p_memsz = OUTPUT_BUFFER + OUTPUT_BUFFER_SIZE - DATA_ADDRESS;
+    segments[1].p_align = 0x1000;
+
+    std::ofstream file(path, ios::out | ios::binary | ios::trunc);
+    if (!file.is_open()) {
+        error = "Failed to open " + path;
+        return false;
+    }
+    file.write((const char *)&header, sizeof(header));
+    file.write((const char *)segments, sizeof(segments));
+    file.write((const char *)out.get_code().data(), out.size());
+    std::vector<char> padding(data_offset - headers - out.size());
+    file.write(padding.data(), padding.size());
+    file.write((const char *)io_table, sizeof(io_table));
+    file.close();
+    if (!file) {
+        error = "Failed to write " + path;
+        return false;
+    }
+    chmod(path.c_str(), 0755);
+    return true;
+}
+
+// putchar() and getchar() for programs run in this process
+static void *HostIO[2] = { (void *)&putchar, (void *)&getchar };
+
+// Machine code for a program, mapped executable in this process
+class Program {
+    void *code = MAP_FAILED;
+    size_t size = 0;
+
+public:
+    Program() = default;
+    Program(const Program &) = delete;
+
+    ~Program() {
+        if (code != MAP_FAILED) {
+            munmap(code, size);
+        }
+    }
+
+    size_t get_size() const {
+        return size;
+    }
+
+    // Emit the program and map it executable, returns its entry point
+    void (*load(const EmitFunction &emit, std::string &error))() {
+        Assembler out;
+        size_t entry = emit(out, (uint64_t)HostIO);
+
+        size = out.size();
+        code = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (code == MAP_FAILED) {
+            error = std::string("Failed to map code: ") + strerror(errno);
+            return nullptr;
+        }
+        memcpy(code, out.get_code().data(), size);
+        if (mprotect(code, size, PROT_READ | PROT_EXEC) < 0) {
+            error = std::string("Failed to map code: ") + strerror(errno);
+            return nullptr;
+        }
+        return (void (*)())((uint8_t *)code + entry);
+    }
+};
+}
+
+namespace Stencils {
+
+// What a hole in a stencil is patched with
+enum HoleKind {
+    CELL,       // disp32, the cell relative to rbx
+    SOURCE,     // disp32, the cell a product is taken of
+    VALUE,      // imm8
+    FACTOR,     // imm32
+    STEP,       // imm32, the cells to move rbx by
+    TARGET,     // rel32, where a jump goes
+    TAPE_SIZE,  // imm64
+    IO_TABLE,   // imm64, the table of putchar() and getchar()
+};
+
+struct Hole {
+    size_t at;
+    HoleKind kind;
+};
+
+// Machine code for one operation, assembled once and copied for every
+// use with its holes patched. The register use is the x86 backend's: rbx
+// points at the head, r12 at the I/O table and r13 at the tape.
+struct Stencil {
+    std::vector<uint8_t> code;
+    std::vector<Hole> holes;
+
+    size_t hole(HoleKind kind) const {
+        for (const Hole &hole: holes) {
+            if (hole.kind == kind) {
+                return hole.at;
+            }
+        }
+        llvm_unreachable("the stencil has no such hole");
+    }
+};
+
+// push rbx, r12 and r13, mmap() the tape and jump to FAIL if that
+// failed, point r13 at the tape, rbx at the start cell and r12 at the
+// I/O table
+static const Stencil ENTER = {
+    {
+        0x53, 0x41, 0x54, 0x41, 0x55,
+        0xB8, 0x09, 0x00, 0x00, 0x00,                   // mov eax, SYS_mmap
+        0x31, 0xFF,                                     // xor edi, edi
+        0x48, 0xBE, 0, 0, 0, 0, 0, 0, 0, 0,             // mov rsi, TAPE_SIZE
+        0xBA, 0x03, 0x00, 0x00, 0x00,                   // mov edx, PROT_READ | PROT_WRITE
+        0x41, 0xBA, 0x22, 0x40, 0x00, 0x00,             // mov r10d, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE
+        0x49, 0xC7, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,       // mov r8, -1
+        0x45, 0x31, 0xC9,                               // xor r9d, r9d
+        0x0F, 0x05,                                     // syscall
+        0x48, 0x3D, 0x00, 0xF0, 0xFF, 0xFF,             // cmp rax, -4096
+        0x0F, 0x87, 0, 0, 0, 0,                         // ja TARGET
+        0x49, 0x89, 0xC5,                               // mov r13, rax
+        0x48, 0x8D, 0x98, 0, 0, 0, 0,                   // lea rbx, [rax + CELL]
+        0x49, 0xBC, 0, 0, 0, 0, 0, 0, 0, 0,             // mov r12, IO_TABLE
+    },
+    { { 14, TAPE_SIZE }, { 53, TARGET }, { 63, CELL }, { 69, IO_TABLE } },
+};
+
+// munmap() the tape, then pop the registers ENTER pushed and return
+static const Stencil LEAVE = {
+    {
+        0xB8, 0x0B, 0x00, 0x00, 0x00,                   // mov eax, SYS_munmap
+        0x4C, 0x89, 0xEF,                               // mov rdi, r13
+        0x48, 0xBE, 0, 0, 0, 0, 0, 0, 0, 0,             // mov rsi, TAPE_SIZE
+        0x0F, 0x05,                                     // syscall
+        0x41, 0x5D, 0x41, 0x5C, 0x5B,                   // pop r13, r12 and rbx
+        0xC3,                                           // ret
+    },
+    { { 10, TAPE_SIZE } },
+};
+
+// Where a failed ENTER returns to in LEAVE
+const size_t LEAVE_RETURN = 20;
+
+// write() why the tape couldn't be mapped to stderr and jump to TARGET
+static const Stencil FAIL = {
+    {
+        0xB8, 0x01, 0x00, 0x00, 0x00,                   // mov eax, SYS_write
+        0xBF, 0x02, 0x00, 0x00, 0x00,                   // mov edi, STDERR_FILENO
+        0x48, 0x8D, 0x35, 0x0C, 0x00, 0x00, 0x00,       // lea rsi, [rip + the message]
+        0xBA, 0x12, 0x00, 0x00, 0x00,                   // mov edx, the message's length
+        0x0F, 0x05,                                     // syscall
+        0xE9, 0, 0, 0, 0,                               // jmp TARGET
+        't', 'a', 'p', 'e', ':', ' ', 'm', 'm', 'a', 'p', ' ', 'f', 'a', 'i', 'l', 'e', 'd', '\n',
+    },
+    { { 25, TARGET } },
+};
+
+// add byte [rbx + CELL], VALUE
+static const Stencil ADD = {
+    { 0x80, 0x83, 0, 0, 0, 0, 0 },
+    { { 2, CELL }, { 6, VALUE } },
+};
+
+// mov byte [rbx + CELL], VALUE
+static const Stencil SET = {
+    { 0xC6, 0x83, 0, 0, 0, 0, 0 },
+    { { 2, CELL }, { 6, VALUE } },
+};
+
+// movzx eax, byte [rbx + SOURCE]; add byte [rbx + CELL], al
+static const Stencil COPY_ADD = {
+    { 0x0F, 0xB6, 0x83, 0, 0, 0, 0, 0x00, 0x83, 0, 0, 0, 0 },
+    { { 3, SOURCE }, { 9, CELL } },
+};
+
+// movzx eax, byte [rbx + SOURCE]; imul eax, eax, FACTOR; add byte [rbx + CELL], al
+static const Stencil MULTIPLY_ADD = {
+    { 0x0F, 0xB6, 0x83, 0, 0, 0, 0, 0x69, 0xC0, 0, 0, 0, 0, 0x00, 0x83, 0, 0, 0, 0 },
+    { { 3, SOURCE }, { 9, FACTOR }, { 15, CELL } },
+};
+
+// add rbx, STEP
+static const Stencil MOVE = {
+    { 0x48, 0x81, 0xC3, 0, 0, 0, 0 },
+    { { 3, STEP } },
+};
+
+// cmp byte [rbx + CELL], 0; je TARGET
+static const Stencil SKIP_IF_ZERO = {
+    { 0x80, 0xBB, 0, 0, 0, 0, 0x00, 0x0F, 0x84, 0, 0, 0, 0 },
+    { { 2, CELL }, { 9, TARGET } },
+};
+
+// cmp byte [rbx], 0; je TARGET
+static const Stencil LOOP_HEAD = {
+    { 0x80, 0x3B, 0x00, 0x0F, 0x84, 0, 0, 0, 0 },
+    { { 5, TARGET } },
+};
+
+// cmp byte [rbx], 0; jne TARGET
+static const Stencil LOOP_TAIL = {
+    { 0x80, 0x3B, 0x00, 0x0F, 0x85, 0, 0, 0, 0 },
+    { { 5, TARGET } },
+};
+
+// [>] and [<]: move rbx by STEP until it points at a zero
+static const Stencil SCAN = {
+    {
+        0x80, 0x3B, 0x00,                               // cmp byte [rbx], 0
+        0x74, 0x0C,                                     // je past the end
+        0x48, 0x81, 0xC3, 0, 0, 0, 0,                   // add rbx, STEP
+        0x80, 0x3B, 0x00,                               // cmp byte [rbx], 0
+        0x75, 0xF4,                                     // jne back to the add
+    },
+    { { 8, STEP } },
+};
+
+// movzx edi, byte [rbx + CELL]; call [r12]
+static const Stencil PUT = {
+    { 0x0F, 0xB6, 0xBB, 0, 0, 0, 0, 0x41, 0xFF, 0x14, 0x24 },
+    { { 3, CELL } },
+};
+
+// call [r12 + 8]; mov byte [rbx + CELL], al
+static const Stencil GET = {
+    { 0x41, 0xFF, 0x54, 0x24, 0x08, 0x88, 0x83, 0, 0, 0, 0 },
+    { { 7, CELL } },
+};
+
+// The values to patch the holes of a stencil with
+struct Patch {
+    int64_t cell = 0;
+    int64_t source = 0;
+    uint8_t value = 0;
+    int64_t factor = 0;
+    int64_t step = 0;
+    size_t target = 0;
+    uint64_t tape_size = 0;
+    uint64_t io_table = 0;
+};
+
+// Emits a program of any of the AST's nodes by copying stencils. Like
+// the x86 backend, it folds adds and sets and keeps moves as
+// displacements. Loops with a closed form or a known idiom run as the
+// loops they replace.
+class Emitter {
+    template <typename E>
+    friend void X86::emit_multiply_loop(E &emitter, int64_t cell, const std::map<int64_t, uint8_t> &products);
+
+    X86::Assembler &out;
+    uint64_t io_table;
+
+    // rbx points `offset` cells before the head
+    int64_t offset = 0;
+
+    // The add or set on the cell at `at` that is yet to be copied
+    bool pending = false;
+    bool pending_set = false;
+    int64_t pending_at = 0;
+    uint8_t pending_value = 0;
+
+    const int64_t MAX_OFFSET = 1 << 30;
+
+    // Copy a stencil and patch its holes, returns where it starts.
+    // Jumps without a target are left for the caller to patch.
+    size_t copy(const Stencil &stencil, const Patch &patch) {
+        size_t start = out.size();
+        out.append(stencil.code);
+        for (const Hole &hole: stencil.holes) {
+            size_t at = start + hole.at;
+            switch (hole.kind) {
+                case CELL:
+                    out.write(at, patch.cell, 4);
+                    break;
+                case SOURCE:
+                    out.write(at, patch.source, 4);
+                    break;
+                case VALUE:
+                    out.write(at, patch.value, 1);
+                    break;
+                case FACTOR:
+                    out.write(at, patch.factor, 4);
+                    break;
+                case STEP:
+                    out.write(at, patch.step, 4);
+                    break;
+                case TARGET:
+                    if (patch.target) {
+                        out.patch(at, patch.target);
+                    }
+                    break;
+                case TAPE_SIZE:
+                    out.write(at, patch.tape_size, 8);
+                    break;
+                case IO_TABLE:
+                    out.write(at, patch.io_table, 8);
+                    break;
+            }
+        }
+        return start;
+    }
+
+    void flush_pending() {
+        if (!pending) {
+            return;
+        }
+        pending = false;
+        Patch patch;
+        patch.cell = pending_at;
+        patch.value = pending_value;
+        if (pending_set) {
+            copy(SET, patch);
+        } else if (pending_value != 0) {
+            copy(ADD, patch);
+        }
+    }
+
+    void flush_offset() {
+        flush_pending();
+        if (offset != 0) {
+            Patch patch;
+            patch.step = offset;
+            copy(MOVE, patch);
+            offset = 0;
+        }
+    }
+
+    void add(int64_t cell, uint8_t value) {
+        if (pending && pending_at == offset + cell) {
+            pending_value += value;
+            return;
+        }
+        flush_pending();
+        pending = true;
+        pending_set = false;
+        pending_at = offset + cell;
+        pending_value = value;
+    }
+
+    void set(int64_t cell, uint8_t value) {
+        if (!pending || pending_at != offset + cell) {
+            flush_pending();
+        }
+        pending = true;
+        pending_set = true;
+        pending_at = offset + cell;
+        pending_value = value;
+    }
+
+    void move(int64_t step) {
+        offset += step;
+        if (offset > MAX_OFFSET || offset < -MAX_OFFSET) {
+            flush_offset();
+        }
+    }
+
+    // c[cell] += c[source] * factor
+    void multiply_add(int64_t cell, int64_t source, uint8_t factor) {
+        flush_pending();
+        Patch patch;
+        patch.cell = offset + cell;
+        patch.source = offset + source;
+        patch.factor = factor;
+        if (factor == 1) {
+            copy(COPY_ADD, patch);
+        } else if (factor != 0) {
+            copy(MULTIPLY_ADD, patch);
+        }
+    }
+
+    // Jump to where end_skip() is called if c[cell] is zero
+    size_t skip_if_zero(int64_t cell) {
+        flush_pending();
+        Patch patch;
+        patch.cell = offset + cell;
+        return copy(SKIP_IF_ZERO, patch) + SKIP_IF_ZERO.hole(TARGET);
+    }
+
+    void end_skip(size_t skip) {
+        flush_pending();
+        out.patch(skip, out.size());
+    }
+
+    // The step of a loop that only moves, or 0
+    static int64_t scan_step(Ast::ConditionalGroupNode *loop) {
+        int64_t step = 0;
+        for (Ast::Node *child: loop->get_children()) {
+            if (isa<Ast::MoveRightNode>(child)) {
+                step++;
+            } else if (isa<Ast::MoveLeftNode>(child)) {
+                step--;
+            } else if (auto *move = dyn_cast<Ast::MoveNode>(child)) {
+                step += move->get_amount();
+            } else {
+                return 0;
+            }
+        }
+        return step;
+    }
+
+    void emit_loop(Ast::ConditionalGroupNode *loop) {
+        // Clear and multiplication loops
+        std::map<int64_t, uint8_t> products;
+        if (X86::multiply_loop(loop, products)) {
+            X86::emit_multiply_loop(*this, 0, products);
+            return;
+        }
+
+        flush_offset();
+        int64_t step = scan_step(loop);
+        if (step != 0 && step >= -MAX_OFFSET && step <= MAX_OFFSET) {
+            Patch patch;
+            patch.step = step;
+            copy(SCAN, patch);
+            return;
+        }
+
+        size_t head = copy(LOOP_HEAD, Patch());
+        size_t body = out.size();
+        emit_children(loop->get_children());
+        flush_offset();
+
+        Patch tail;
+        tail.target = body;
+        copy(LOOP_TAIL, tail);
+        out.patch(head + LOOP_HEAD.hole(TARGET), out.size());
+    }
+
+    void emit_node(Ast::Node *node) {
+        switch (node->getKind()) {
+            case Ast::Node::NK_Increment:
+                add(0, 1);
+                break;
+            case Ast::Node::NK_Decrement:
+                add(0, 255);
+                break;
+            case Ast::Node::NK_MoveRight:
+                move(1);
+                break;
+            case Ast::Node::NK_MoveLeft:
+                move(-1);
+                break;
+            case Ast::Node::NK_PutChar: {
+                flush_pending();
+                Patch patch;
+                patch.cell = offset;
+                copy(PUT, patch);
+                break;
+            }
+            case Ast::Node::NK_GetChar: {
+                flush_pending();
+                Patch patch;
+                patch.cell = offset;
+                copy(GET, patch);
+                break;
+            }
+            case Ast::Node::NK_Add: {
+                auto *add_node = cast<Ast::AddNode>(node);
+                add(add_node->get_offset(), add_node->get_amount());
+                break;
+            }
+            case Ast::Node::NK_Set: {
+                auto *set_node = cast<Ast::SetNode>(node);
+                set(set_node->get_offset(), set_node->get_value());
+                break;
+            }
+            case Ast::Node::NK_Move:
+                move(cast<Ast::MoveNode>(node)->get_amount());
+                break;
+            case Ast::Node::NK_MultiplyAdd: {
+                // Like the loop it came from, only touches the cell if the
+                // source isn't zero
+                auto *multiply = cast<Ast::MultiplyAddNode>(node);
+                size_t skip = skip_if_zero(multiply->get_source());
+                multiply_add(multiply->get_offset(), multiply->get_source(), multiply->get_factor());
+                end_skip(skip);
+                break;
+            }
+            case Ast::Node::NK_ClearRange: {
+                auto *range = cast<Ast::ClearRangeNode>(node);
+                for (size_t i = 0; i < range->get_count(); i++) {
+                    set((int64_t)i * range->get_step(), 0);
+                }
+                move((int64_t)(range->get_count() - 1) * range->get_step());
+                break;
+            }
+            case Ast::Node::NK_TransferChain: {
+                auto *chain = cast<Ast::TransferChainNode>(node);
+                for (size_t i = 0; i < chain->get_count(); i++) {
+                    X86::emit_multiply_loop(*this, (int64_t)i * chain->get_step(), { { chain->get_target(), 1 } });
+                }
+                move((int64_t)(chain->get_count() - 1) * chain->get_step());
+                break;
+            }
+            case Ast::Node::NK_ClosedFormLoop:
+                emit_node(cast<Ast::ClosedFormLoopNode>(node)->get_loop());
+                break;
+            case Ast::Node::NK_DivMod:
+                emit_node(cast<Ast::DivModNode>(node)->get_loop());
+                break;
+            case Ast::Node::NK_ConditionalGroup:
+                emit_loop(cast<Ast::ConditionalGroupNode>(node));
+                break;
+            case Ast::Node::NK_Scope:
+                llvm_unreachable("programs don't nest");
+        }
+    }
+
+    void emit_children(std::vector<Ast::Node *> &children) {
+        for (Ast::Node *child: children) {
+            emit_node(child);
+        }
+    }
+
+public:
+    Emitter(X86::Assembler &out, uint64_t io_table): out(out), io_table(io_table) {}
+
+    // Emit the program as a function, returns where it starts
+    size_t emit(Ast::ProgramNode *program) {
+        Analysis::clear();
+        TapeLayout::Layout layout = TapeLayout::plan();
+
+        Patch patch;
+        patch.cell = layout.start;
+        patch.tape_size = layout.size;
+        patch.io_table = io_table;
+        size_t entry = copy(ENTER, patch);
+
+        emit_children(program->get_children());
+        flush_pending();
+
+        size_t leave = copy(LEAVE, patch);
+        out.patch(entry + ENTER.hole(TARGET), out.size());
+        patch.target = leave + LEAVE_RETURN;
+        copy(FAIL, patch);
+        return entry;
+    }
+};
+}
+
+namespace Native {
 
-    Ast::Node* node;
-    while ((node = Ast::Node::try_parse(in))) {
-        children.push_back(node);
+// The emitter of the backend chosen with --backend
+static X86::EmitFunction get_emitter(Ast::ProgramNode *program) {
+    if (Backend == STENCIL_BACKEND) {
+        return [program](X86::Assembler &out, uint64_t io_table) {
+            return Stencils::Emitter(out, io_table).emit(program);
+        };
     }
+    return [program](X86::Assembler &out, uint64_t io_table) {
+        return X86::Emitter(out, io_table).emit(program);
+    };
+}
 
-    return new Ast::ProgramNode(std::move(children));
+// Compile the program with one of the native backends and run it or
+// write it to the output file
+static int run(std::istream &in) {
+    Ast::Node *root;
+    {
+        TimeReport::Scope phase("parse");
+        root = Ast::ProgramNode::try_parse(in);
+    }
+    if (!root) {
+        std::cout << "Failed to parse AST" << std::endl;
+        return -1;
+    }
+    Ast::ProgramNode *program = cast<Ast::ProgramNode>(root);
+    TimeReport::node_count("parsed", program->count_nodes());
+
+    if (Backend == STENCIL_BACKEND && RunAstPasses) {
+        AstPasses::run_linear_pipeline(program);
+    }
+
+    std::string error;
+    if (!RunProgram) {
+        TimeReport::Scope phase("native emit");
+        if (!X86::write_executable(get_emitter(program), OutputFilename, error)) {
+            std::cout << error << std::endl;
+            return -1;
+        }
+        return 0;
+    }
+
+    X86::Program code;
+    void (*entry)();
+    {
+        TimeReport::Scope phase("native emit");
+        entry = code.load(get_emitter(program), error);
+    }
+    if (!entry) {
+        std::cout << error << std::endl;
+        return -1;
+    }
+    {
+        TimeReport::Scope phase("execute");
+        entry();
+        fflush(stdout);
+    }
+    return 0;
+}
 }
 
-Ast::Node* Ast::ConditionalGroupNode::try_parse(fstream &in) {
-    std::vector<Ast::Node *> children = {};
+namespace Bench {
 
-    Ast::Node* node;
-    while ((node = Ast::Node::try_parse(in))) {
-        children.push_back(node);
+using Clock = std::chrono::steady_clock;
+
+static double elapsed_ms(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// Run the program in a child process, with its input taken from
+// <program>.in if that exists. Its output is discarded, unless there is a
+// <program>.out to compare it to; `correct` is cleared if it doesn't match.
+// Returns the time spent inside the entry point, or a negative value if the
+// program did not finish.
+static double execute(void (*entry)(), const std::string &program, bool &correct) {
+    int timing[2];
+    if (pipe(timing) < 0) {
+        return -1;
+    }
+
+    std::string expected = program + ".out";
+    int output = -1;
+    SmallString<64> output_path;
+    if (sys::fs::exists(expected) && sys::fs::createTemporaryFile("bench", "out", output, output_path)) {
+        output = -1;
+    }
+
+    pid_t child = fork();
+    if (child == 0) {
+        std::string input = program + ".in";
+        int in = open(sys::fs::exists(input) ? input.c_str() : "/dev/null", O_RDONLY);
+        int out = output >= 0 ? output : open("/dev/null", O_WRONLY);
+        dup2(in, STDIN_FILENO);
+        dup2(out, STDOUT_FILENO);
+        alarm(BenchmarkTimeout);
+
+        Clock::time_point start = Clock::now();
+        entry();
+        fflush(stdout);
+        double ms = elapsed_ms(start);
+
+        write(timing[1], &ms, sizeof(ms));
+        _exit(0);
+    }
+    close(timing[1]);
+
+    double ms = -1;
+    if (child < 0 || read(timing[0], &ms, sizeof(ms)) != sizeof(ms)) {
+        ms = -1;
+    }
+    close(timing[0]);
+    if (child > 0) {
+        waitpid(child, nullptr, 0);
     }
 
-    return new Ast::ConditionalGroupNode(std::move(children));
+    if (output >= 0) {
+        close(output);
+        auto actual = MemoryBuffer::getFile(output_path);
+        auto wanted = MemoryBuffer::getFile(expected);
+        if (ms >= 0 && (!actual || !wanted || (*actual)->getBuffer() != (*wanted)->getBuffer())) {
+            correct = false;
+        }
+        sys::fs::remove(output_path);
+    }
+    return ms;
 }
 
-int main() {
-    fstream in("program.bf");
-    if (!in.is_open()) {
-        std::cout << "Failed to open input file" << std::endl;
+// Execute the program as often as asked and finish the report with the
+// times of each run and the best of them, and whether the output was right
+// if the expected output is known
+static void report_runs(json::OStream &report, void (*entry)(), const std::string &program) {
+    double best = -1;
+    bool correct = true;
+    report.attributeBegin("execute_runs_ms");
+    report.arrayBegin();
+    for (unsigned i = 0; i < std::max(1u, (unsigned)BenchmarkRuns); i++) {
+        double ms = execute(entry, program, correct);
+        if (ms < 0) {
+            report.value(nullptr);
+            continue;
+        }
+        report.value(ms);
+        if (best < 0 || ms < best) {
+            best = ms;
+        }
+    }
+    report.arrayEnd();
+    report.attributeEnd();
+
+    if (best < 0) {
+        report.attribute("execute_ms", nullptr);
+    } else {
+        report.attribute("execute_ms", best);
+    }
+    if (sys::fs::exists(program + ".out")) {
+        report.attribute("output_correct", best >= 0 && correct);
+    }
+    report.objectEnd();
+    outs() << "\n";
+}
+
+// Compile the program phase by phase and print a JSON report of how long
+// each phase took, followed by the execution times of the native code.
+static int run(const std::string &program) {
+    json::OStream report(outs());
+    report.objectBegin();
+    report.attribute("program", program);
+    report.attribute("engine", Backend.getValue() == LLVM_BACKEND ? "llvm"
+        : Backend.getValue() == X86_BACKEND ? "x86" : "stencil");
+
+    auto fail = [&](const std::string &error) {
+        report.attribute("error", error);
+        report.objectEnd();
+        outs() << "\n";
         return -1;
+    };
+
+    fstream in(program, ios::in);
+    if (!in.is_open()) {
+        return fail("Failed to open input file");
     }
 
-    // build the AST
+    Clock::time_point start = Clock::now();
     Ast::Node *root = Ast::ProgramNode::try_parse(in);
+    report.attribute("parse_ms", elapsed_ms(start));
     if (!root) {
-        std::cout << "Failed to parse AST" << std::endl;
+        return fail("Failed to parse AST");
+    }
+
+    std::string error;
+    if (Backend != LLVM_BACKEND) {
+        Ast::ProgramNode *native_program = cast<Ast::ProgramNode>(root);
+        if (Backend == STENCIL_BACKEND) {
+            start = Clock::now();
+            if (RunAstPasses) {
+                AstPasses::run_linear_pipeline(native_program);
+            }
+            report.attribute("ast_passes_ms", elapsed_ms(start));
+        }
+
+        X86::Program code;
+        start = Clock::now();
+        void (*entry)() = code.load(Native::get_emitter(native_program), error);
+        report.attribute("emit_ms", elapsed_ms(start));
+        if (!entry) {
+            return fail(error);
+        }
+        report.attribute("object_bytes", (int64_t)code.get_size());
+        report_runs(report, entry, program);
+        return 0;
+    }
+
+    start = Clock::now();
+    if (RunAstPasses) {
+        AstPasses::run(root);
+    }
+    report.attribute("ast_passes_ms", elapsed_ms(start));
+
+    start = Clock::now();
+    if (!codegen_program(root, error)) {
+        return fail(error);
+    }
+    report.attribute("codegen_ms", elapsed_ms(start));
+
+    start = Clock::now();
+    if (!optimize_program(error)) {
+        return fail(error);
+    }
+    report.attribute("optimize_ms", elapsed_ms(start));
+
+    std::vector<SmallVector<char, 0>> objects;
+    start = Clock::now();
+    if (!emit_objects(objects, error)) {
+        return fail(error);
+    }
+    report.attribute("emit_ms", elapsed_ms(start));
+    int64_t object_bytes = 0;
+    for (SmallVector<char, 0> &object: objects) {
+        object_bytes += object.size();
+    }
+    report.attribute("object_bytes", object_bytes);
+
+    // Link the very objects we just timed and run them
+    auto jit = create_jit();
+    if (!jit) {
+        return fail(toString(jit.takeError()));
+    }
+    if (Error err = add_objects(**jit, objects, program)) {
+        return fail(toString(std::move(err)));
+    }
+    auto entry = jit_entry_point(**jit);
+    if (!entry) {
+        return fail(toString(entry.takeError()));
+    }
+    report_runs(report, *entry, program);
+    return 0;
+}
+
+}
+
+namespace Stream {
+
+// Compile and run the program one chunk of top-level nodes at a time.
+// The AST, IR and machine code of a chunk are freed once it has run, so
+// memory use is bounded by the biggest loop nest rather than the program.
+// Nothing is known about the tape a chunk starts with, so the analysis
+// is left out and the tape is planned without it. The tape gets a
+// margin like the ones main() maps, so that the AST passes' code only
+// has to test the cells it may touch past the margin.
+static int run(std::istream &in) {
+    if (LoopProfile::enabled()) {
+        std::cout << "--stream can't write a loop profile" << std::endl;
         return -1;
     }
-    in.close();
 
-    // Setup LLVM data structures
-    llvm_init();
+    auto jit = create_jit();
+    if (!jit) {
+        errs() << toString(jit.takeError()) << "\n";
+        return -1;
+    }
 
-    // Emit LLVM IR code
-    root->codegen();
+    Analysis::clear();
+    TapeLayout::Current = TapeLayout::plan();
+    TapeLayout::Margin = TAPE_MARGIN;
+    uint64_t size = TapeLayout::Current.size + 2 * TAPE_MARGIN;
+    uint8_t *mapping = (uint8_t *)mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (mapping == MAP_FAILED) {
+        perror("tape");
+        return -1;
+    }
+    uint8_t *tape = mapping + TAPE_MARGIN;
+
+    int64_t position = 0;
+    BoundsCheck::SourceOffset = 0;
+    bool done = false;
+    for (unsigned index = 0; !done; index++) {
+        std::vector<Ast::Node *> children;
+        size_t nodes = 0;
+        while (nodes < StreamChunk) {
+            Ast::Node *node = Ast::Node::try_parse(in);
+            if (!node) {
+                done = true;
+                break;
+            }
+            nodes += node->count_nodes();
+            children.push_back(node);
+        }
+        if (children.empty()) {
+            break;
+        }
+
+        Ast::ProgramNode *chunk = new Ast::ProgramNode(std::move(children));
+        if (RunAstPasses) {
+            AstPasses::run_pipeline(chunk);
+        }
+
+        std::string name = "chunk " + std::to_string(index);
+        llvm_init();
+        chunk->codegen_chunk(name);
+        Ast::free_nodes();
+        std::string error;
+        if (!optimize_program(error)) {
+            errs() << error << "\n";
+            return -1;
+        }
+
+        // Both of these refer to the module we are about to give away
+        TheFPM.reset();
+        Builder.reset();
+
+        orc::ResourceTrackerSP tracker = (*jit)->getMainJITDylib().createResourceTracker();
+        orc::ThreadSafeModule module(std::move(TheModule), std::move(TheContext));
+        if (Error err = (*jit)->addIRModule(tracker, std::move(module))) {
+            errs() << toString(std::move(err)) << "\n";
+            return -1;
+        }
+        auto symbol = (*jit)->lookup(name);
+        if (!symbol) {
+            errs() << toString(symbol.takeError()) << "\n";
+            return -1;
+        }
+        auto function = jitTargetAddressToPointer<int64_t (*)(uint8_t *, int64_t)>(symbol->getAddress());
+        position = function(tape, position);
+
+        // Each chunk runs exactly once
+        if (Error err = tracker->remove()) {
+            errs() << toString(std::move(err)) << "\n";
+            return -1;
+        }
+    }
+
+    fflush(stdout);
+    munmap(mapping, size);
+    return 0;
+}
+}
+
+#endif
 
-    Function* main = TheModule->getFunction("main");
-    if (!main) {
-        std::cout << "main() was not defined" << std::endl;
+namespace bfllvm {
+
+// Programs are compiled like with --entry
+struct CompiledProgram::State {
+    std::unique_ptr<orc::LLJIT> jit;
+    size_t (*function)(uint8_t *, size_t, bf_io *) = nullptr;
+    uint64_t tape_size = 0;
+};
+
+struct Streams {
+    std::istream &in;
+    std::ostream &out;
+};
+
+static int put(void *context, int c) {
+    ((Streams *)context)->out.put((char)c);
+    return c;
+}
+
+static int get(void *context) {
+    return ((Streams *)context)->in.get();
+}
+
+CompiledProgram::CompiledProgram(std::unique_ptr<State> state): state(std::move(state)) {}
+
+CompiledProgram::~CompiledProgram() = default;
+
+uint64_t CompiledProgram::tape_size() const {
+    return state->tape_size;
+}
+
+bool CompiledProgram::run(uint8_t *tape, std::istream &in, std::ostream &out, std::string &error) const {
+    Streams streams = { in, out };
+    bf_io io = { &streams, &put, &get };
+    if (state->function(tape, 0, &io) == BF_OVERRUN) {
+        error = "tape overrun";
+        return false;
+    }
+    return true;
+}
+
+// The command line options are globals
+static std::mutex CompileLock;
+
+std::unique_ptr<CompiledProgram> compile(const std::string &source, const Options &options, std::string &error) {
+    static std::once_flag targets;
+    std::call_once(targets, llvm_init_targets);
+
+    std::lock_guard<std::mutex> guard(CompileLock);
+    PromoteCells = options.promote_cells;
+    RunAstPasses = options.ast_passes;
+    BoundsChecks = options.bounds_check;
+    TapeSize = options.tape_size;
+    OutlineThreshold = options.outline_threshold;
+
+    std::istringstream in(source);
+    bool compiled = compile_entry(in, error);
+    Ast::free_nodes();
+    if (!compiled) {
+        return nullptr;
+    }
+
+    auto jit = jit_module();
+    if (!jit) {
+        error = toString(jit.takeError());
+        return nullptr;
+    }
+
+    auto symbol = (*jit)->lookup("bf_run");
+    if (!symbol) {
+        error = toString(symbol.takeError());
+        return nullptr;
+    }
+
+    auto state = std::make_unique<CompiledProgram::State>();
+    state->jit = std::move(*jit);
+    state->function = jitTargetAddressToPointer<size_t (*)(uint8_t *, size_t, bf_io *)>(symbol->getAddress());
+    state->tape_size = TapeLayout::Current.size;
+    return std::make_unique<CompiledProgram>(std::move(state));
+}
+}
+
+#ifndef BFLLVM_LIBRARY
+namespace Filter {
+
+// Records are read and run this many per worker at a time
+const size_t BATCH_RECORDS = 1024;
+
+struct Record {
+    std::string input;
+    size_t read = 0;
+    std::string output;
+    bool overrun = false;
+};
+
+static int put(void *context, int c) {
+    ((Record *)context)->output.push_back((char)c);
+    return c;
+}
+
+static int get(void *context) {
+    Record *record = (Record *)context;
+    if (record->read == record->input.size()) {
+        return EOF;
+    }
+    return (unsigned char)record->input[record->read++];
+}
+
+static bool parse_delimiter(const std::string &text, char &delimiter) {
+    if (text.size() == 1) {
+        delimiter = text[0];
+        return true;
+    }
+    std::map<std::string, char> escapes = { { "\\n", '\n' }, { "\\t", '\t' }, { "\\0", '\0' } };
+    auto it = escapes.find(text);
+    if (it == escapes.end()) {
+        return false;
+    }
+    delimiter = it->second;
+    return true;
+}
+
+// Zero what the last record left on a tape. The pages that most
+// records stay on, at the start of the tape, are cleared in place where
+// mincore() finds them touched, so the next record doesn't fault them in
+// again. Beyond those, the few pages a record got to are given back,
+// which costs next to nothing when there are none.
+static void clear_tape(uint8_t *tape, uint64_t size, std::vector<unsigned char> &resident) {
+    uint64_t page = sysconf(_SC_PAGESIZE);
+    uint64_t kept = std::min(size, std::max(MAX_STACK_TAPE, page));
+    resident.resize((kept + page - 1) / page);
+    if (mincore(tape, kept, resident.data()) != 0) {
+        kept = 0;
+    }
+    for (size_t i = 0; i < resident.size() && i * page < kept; i++) {
+        if (resident[i] & 1) {
+            memset(tape + i * page, 0, std::min(page, kept - i * page));
+        }
+    }
+    if (kept < size) {
+        madvise(tape + kept, size - kept, MADV_DONTNEED);
+    }
+}
+
+// Compile the program once as a reentrant bf_run(), then run it over
+// the records of stdin on a pool of threads. Threads take the next
+// record of a batch as they become free, and the outputs of a batch
+// are written in input order, each followed by the delimiter. A record
+// that runs off the tape keeps the output it got to and is reported on
+// stderr, and the rest of the records still run.
+static int run(std::istream &in) {
+    char delimiter;
+    if (!parse_delimiter(RecordDelimiter, delimiter)) {
+        std::cout << "--record-delimiter must be a single character" << std::endl;
+        return -1;
+    }
+
+    std::string error;
+    if (!compile_entry(in, error)) {
+        std::cout << error << std::endl;
+        return -1;
+    }
+    uint64_t size = TapeLayout::Current.size;
+
+    auto jit = jit_module();
+    if (!jit) {
+        errs() << toString(jit.takeError()) << "\n";
+        return -1;
+    }
+    auto symbol = (*jit)->lookup("bf_run");
+    if (!symbol) {
+        errs() << toString(symbol.takeError()) << "\n";
+        return -1;
+    }
+    auto function = jitTargetAddressToPointer<size_t (*)(uint8_t *, size_t, bf_io *)>(symbol->getAddress());
+
+    unsigned workers = FilterWorkers ? (unsigned)FilterWorkers : std::max(1u, std::thread::hardware_concurrency());
+    std::vector<uint8_t *> tapes;
+    for (unsigned i = 0; i < workers; i++) {
+        void *tape = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (tape == MAP_FAILED) {
+            perror("tape");
+            return -1;
+        }
+        tapes.push_back((uint8_t *)tape);
+    }
+
+    ThreadPool pool(hardware_concurrency(workers));
+    std::vector<Record> batch(BATCH_RECORDS * workers);
+    size_t first = 0;
+    bool overruns = false;
+    while (true) {
+        size_t count = 0;
+        while (count < batch.size() && std::getline(std::cin, batch[count].input, delimiter)) {
+            batch[count].read = 0;
+            batch[count].output.clear();
+            batch[count].overrun = false;
+            count++;
+        }
+        if (count == 0) {
+            break;
+        }
+
+        std::atomic<size_t> next(0);
+        for (uint8_t *tape: tapes) {
+            pool.async([&, tape]() {
+                std::vector<unsigned char> resident;
+                size_t index;
+                while ((index = next++) < count) {
+                    bf_io io = { &batch[index], &put, &get };
+                    batch[index].overrun = function(tape, 0, &io) == BF_OVERRUN;
+                    clear_tape(tape, size, resident);
+                }
+            });
+        }
+        pool.wait();
+
+        for (size_t i = 0; i < count; i++) {
+            fwrite(batch[i].output.data(), 1, batch[i].output.size(), stdout);
+            fputc(delimiter, stdout);
+            if (batch[i].overrun) {
+                errs() << "record " << first + i + 1 << ": tape overrun\n";
+                overruns = true;
+            }
+        }
+        first += count;
+    }
+
+    fflush(stdout);
+    for (uint8_t *tape: tapes) {
+        munmap(tape, size);
+    }
+    return overruns ? -1 : 0;
+}
+}
+
+// Look up main() in the JIT and run it
+static int run_jit(orc::LLJIT &jit) {
+    Expected<void (*)()> entry = nullptr;
+    {
+        TimeReport::Scope phase("jit");
+        entry = jit_entry_point(jit);
+    }
+    if (!entry) {
+        errs() << toString(entry.takeError()) << "\n";
+        return -1;
+    }
+    {
+        TimeReport::Scope phase("execute");
+        (*entry)();
+        fflush(stdout);
+    }
+    TimeReport::finish();
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    cl::ParseCommandLineOptions(argc, argv, "brainfuck compiler\n");
+
+    llvm_init_targets();
+
+    if (!ServeSocket.empty()) {
+        return Server::serve(ServeSocket);
+    }
+
+    if (!ProfileUse.empty()) {
+        std::string error;
+        if (!LoopProfile::load(ProfileUse, error)) {
+            std::cout << error << std::endl;
+            return -1;
+        }
+    }
+
+    if (RunBenchmark) {
+        return Bench::run(InputFilename);
+    }
+
+    fstream in(InputFilename, ios::in);
+    if (!in.is_open()) {
+        std::cout << "Failed to open input file" << std::endl;
+        return -1;
+    }
+
+    if (Backend != LLVM_BACKEND) {
+        if (BoundsChecks || LoopProfile::enabled() || StreamProgram || EntryPoint || FilterRecords || ForkServerLoop) {
+            std::cout << "Only --backend=llvm supports --bounds-check, --profile, --stream, --entry, --filter"
+                      << " and --fork-server" << std::endl;
+            return -1;
+        }
+        if (TimeReportFlag) {
+            TimeReport::enable();
+        }
+        int result = Native::run(in);
+        TimeReport::finish();
+        return result;
+    }
+
+    if (ForkServerLoop && (RunProgram || StreamProgram || EntryPoint || FilterRecords)) {
+        std::cout << "--fork-server only applies to the main() of printed IR" << std::endl;
+        return -1;
+    }
+
+    if (FilterRecords) {
+        if (RunProgram || StreamProgram || EntryPoint || LoopProfile::enabled()) {
+            std::cout << "--filter can't be combined with --run, --stream, --entry or --profile" << std::endl;
+            return -1;
+        }
+        return Filter::run(in);
+    }
+
+    if (EntryPoint) {
+        if (RunProgram || StreamProgram || LoopProfile::enabled()) {
+            std::cout << "--entry can't be combined with --run, --stream or --profile" << std::endl;
+            return -1;
+        }
+        if (TimeReportFlag) {
+            TimeReport::enable();
+        }
+        std::string error;
+        if (!compile_entry(in, error)) {
+            std::cout << error << std::endl;
+            return -1;
+        }
+        {
+            TimeReport::Scope phase("print");
+            TheModule->print(outs(), nullptr);
+            outs().flush();
+        }
+        TimeReport::finish();
+        return 0;
+    }
+
+    if (StreamProgram) {
+        if (!RunProgram) {
+            std::cout << "--stream only works with --run" << std::endl;
+            return -1;
+        }
+        return Stream::run(in);
+    }
+
+    if (TimeReportFlag) {
+        TimeReport::enable();
+    }
+
+    // With --cache-dir, programs that ran before skip the compiler
+    std::unique_ptr<DiskCache::Cache> cache;
+    std::string key;
+    std::istringstream source;
+    if (RunProgram && !CacheDir.empty()) {
+        std::stringstream text;
+        text << in.rdbuf();
+        source.str(text.str());
+        key = DiskCache::key(source.str());
+        cache = std::make_unique<DiskCache::Cache>(CacheDir);
+
+        std::unique_ptr<MemoryBuffer> object = cache->load(key);
+        if (object) {
+            auto jit = create_jit();
+            if (!jit) {
+                errs() << toString(jit.takeError()) << "\n";
+                return -1;
+            }
+            if (Error err = (*jit)->addObjectFile(std::move(object))) {
+                errs() << toString(std::move(err)) << "\n";
+                return -1;
+            }
+            return run_jit(**jit);
+        }
+    }
+
+    std::string error;
+    if (!compile_module(cache ? (std::istream &)source : in, error)) {
+        std::cout << error << std::endl;
         return -1;
     }
+    in.close();
+
+    if (LoopProfile::Matched < LoopProfile::Recorded.size()) {
+        errs() << "warning: " << LoopProfile::Recorded.size() - LoopProfile::Matched
+               << " loops in the profile do not exist in the program\n";
+    }
 
-    // Optimize the function.
-    TheFPM->run(*main);
+    if (RunProgram) {
+        if (cache) {
+            TheModule->setModuleIdentifier(key);
+        }
+        auto jit = jit_module(cache.get());
+        if (!jit) {
+            errs() << toString(jit.takeError()) << "\n";
+            return -1;
+        }
+        return run_jit(**jit);
+    }
 
     // Dump LLVM IR
-    TheModule->print(outs(), nullptr);
-    
+    {
+        TimeReport::Scope phase("print");
+        TheModule->print(outs(), nullptr);
+        outs().flush();
+    }
+
+    TimeReport::finish();
     return 0;
 }
+#endif